@@ -118,6 +118,51 @@ def print_ir_sizes(ops, defines):
     output_file.write("#undef IROP_SIZES\n")
     output_file.write("#endif\n\n")
 
+# Print out constexpr tables of the properties passes care about
+def print_ir_properties(ops, defines):
+    output_file.write("#ifdef IROP_PROPERTIES\n")
+
+    output_file.write("struct IROpProperties {\n")
+    output_file.write("\tbool HasSideEffects; ///< Must be kept even if the result is unused\n")
+    output_file.write("\tbool Commutative; ///< First two SSA args can be swapped\n")
+    output_file.write("\tbool MemoryRead;\n")
+    output_file.write("\tbool MemoryWrite;\n")
+    output_file.write("\tbool ContextRead;\n")
+    output_file.write("\tbool ContextWrite;\n")
+    output_file.write("\tbool FlagWrite; ///< Can modify the guest flags\n")
+    output_file.write("\tbool CanFault; ///< Must not be executed speculatively\n")
+    output_file.write("\tuint8_t Latency; ///< Rough estimate of host cycles until the result is available\n")
+    output_file.write("\tuint8_t CodeSize; ///< Rough estimate of host instructions emitted\n")
+    output_file.write("};\n\n")
+
+    output_file.write("constexpr std::array<IROpProperties, IROps::OP_LAST + 1> IRProperties = {{\n")
+    for op_key, op_vals in ops.items():
+        MemoryWrite = op_vals.get("MemoryWrite", False)
+        ContextWrite = op_vals.get("ContextWrite", False)
+
+        # Anything that writes state can't be removed
+        HasSideEffects = op_vals.get("HasSideEffects", False) or MemoryWrite or ContextWrite
+
+        output_file.write("\t{%s, %s, %s, %s, %s, %s, %s, %s, %d, %d}, // %s\n" % (
+            str(HasSideEffects).lower(),
+            str(op_vals.get("Commutative", False)).lower(),
+            str(op_vals.get("MemoryRead", False)).lower(),
+            str(MemoryWrite).lower(),
+            str(op_vals.get("ContextRead", False)).lower(),
+            str(ContextWrite).lower(),
+            str(op_vals.get("FlagWrite", False)).lower(),
+            str(op_vals.get("CanFault", False)).lower(),
+            int(op_vals.get("Latency", 1)),
+            int(op_vals.get("CodeSize", 1)),
+            op_key))
+
+    output_file.write("}};\n\n")
+
+    output_file.write("[[maybe_unused]] static constexpr IROpProperties const& GetProperties(IROps Op) { return IRProperties[Op]; }\n\n")
+
+    output_file.write("#undef IROP_PROPERTIES\n")
+    output_file.write("#endif\n\n")
+
 # Print out the name printer implementation
 def print_ir_getname(ops, defines):
     output_file.write("#ifdef IROP_GETNAME_IMPL\n")
@@ -336,6 +381,11 @@ def print_ir_allocator_helpers(ops, defines):
                     output_file.write("\t\tOp.first->Header.Args[%d] = ssa%d->Wrapped(ListData.Begin());\n" % (i, i))
                     output_file.write("\t\tssa%d->AddUse();\n" % (i))
 
+            # Keep the use lists in sync if a pass has built them
+            # LinkArgUses decides which of the arguments are uses
+            if (SSAArgs != 0):
+                output_file.write("\t\tLinkArgUses(Op.Node);\n")
+
             if (HasArgs):
                 for i in range(1, len(op_vals["Args"]), 2):
                     data_name = op_vals["Args"][i]
@@ -385,6 +435,7 @@ output_file = open(output_filename, "w")
 print_enums(ops, defines)
 print_ir_structs(ops, defines)
 print_ir_sizes(ops, defines)
+print_ir_properties(ops, defines)
 print_ir_getname(ops, defines)
 print_ir_getraargs(ops, defines)
 print_ir_arg_printer(ops, defines)
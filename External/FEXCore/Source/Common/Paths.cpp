@@ -6,6 +6,7 @@
 namespace FEXCore::Paths {
   std::string DataPath;
   std::string EntryCache;
+  std::string LLVMCache;
 
   void InitializePaths() {
     char *HomeDir = getenv("HOME");
@@ -20,8 +21,10 @@ namespace FEXCore::Paths {
     }
     DataPath += "/.fexcore/";
     EntryCache = DataPath + "/EntryCache/";
+    LLVMCache = DataPath + "/LLVMCache/";
     mkdir(DataPath.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
     mkdir(EntryCache.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+    mkdir(LLVMCache.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
   }
 
   std::string GetDataPath() {
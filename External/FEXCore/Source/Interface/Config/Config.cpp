@@ -30,6 +30,15 @@ namespace FEXCore::Config {
     case FEXCore::Config::CONFIG_UNIFIED_MEMORY:
       CTX->Config.UnifiedMemory = Config != 0;
     break;
+    case FEXCore::Config::CONFIG_HOSTFEATURES:
+      CTX->Config.HostFeatures = Config != 0;
+    break;
+    case FEXCore::Config::CONFIG_HUGEPAGES:
+      CTX->Config.HugePages = Config != 0;
+    break;
+    case FEXCore::Config::CONFIG_ENTRYCACHE:
+      CTX->Config.EntryCache = Config != 0;
+    break;
     default: LogMan::Msg::A("Unknown configuration option");
     }
   }
@@ -39,6 +48,9 @@ namespace FEXCore::Config {
     case CONFIG_ROOTFSPATH:
       CTX->Config.RootFSPath = Config;
       break;
+    case CONFIG_JITSTATSPATH:
+      CTX->Config.JITStatsPath = Config;
+      break;
     default: LogMan::Msg::A("Unknown configuration option");
     }
   }
@@ -68,6 +80,15 @@ namespace FEXCore::Config {
     case FEXCore::Config::CONFIG_UNIFIED_MEMORY:
       return CTX->Config.UnifiedMemory;
     break;
+    case FEXCore::Config::CONFIG_HOSTFEATURES:
+      return CTX->Config.HostFeatures;
+    break;
+    case FEXCore::Config::CONFIG_HUGEPAGES:
+      return CTX->Config.HugePages;
+    break;
+    case FEXCore::Config::CONFIG_ENTRYCACHE:
+      return CTX->Config.EntryCache;
+    break;
     default: LogMan::Msg::A("Unknown configuration option");
     }
 
@@ -33,8 +33,6 @@ namespace FEXCore::Context {
 
   void SetApplicationFile(FEXCore::Context::Context *CTX, std::string const &File) {
     CTX->SyscallHandler.SetFilename(File);
-    // XXX: This isn't good for debugging
-    // CTX->LoadEntryList();
   }
 
   bool InitCore(FEXCore::Context::Context *CTX, FEXCore::CodeLoader *Loader) {
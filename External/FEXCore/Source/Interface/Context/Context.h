@@ -11,6 +11,7 @@
 #include <FEXCore/Utils/Event.h>
 #include <stdint.h>
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 
@@ -48,6 +49,14 @@ namespace FEXCore::Context {
       bool GdbServer {false};
       bool UnifiedMemory {false};
       std::string RootFSPath;
+      // Per thread JIT compile stats get written here as JSON on shutdown when set
+      std::string JITStatsPath;
+      // Lets the JITs use instruction set extensions the host supports, otherwise only baseline instructions are emitted
+      bool HostFeatures {true};
+      // Backs guest memory and JIT code buffers with huge pages where the host allows it
+      bool HugePages {false};
+      // Loads the block entries seen by previous runs of the application on startup and compiles them up front
+      bool EntryCache {false};
 
       // LLVM JIT options
       bool LLVM_MemoryValidation {false};
@@ -62,7 +71,9 @@ namespace FEXCore::Context {
     FEXCore::Core::InternalThreadState* ParentThread;
     std::vector<FEXCore::Core::InternalThreadState*> Threads;
     std::atomic_bool ShouldStop{};
-    Event PauseWait;
+    // Signaled whenever a thread stops running, WaitForIdle waits on this
+    std::mutex IdleMutex;
+    std::condition_variable IdleWait;
     bool Running{};
     CoreRunningMode RunningMode {CoreRunningMode::MODE_RUN};
     FEXCore::Frontend::Decoder FrontendDecoder;
@@ -110,12 +121,21 @@ namespace FEXCore::Context {
     void LoadEntryList();
 
     uintptr_t CompileBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
+    void CompileBlockBatch(FEXCore::Core::InternalThreadState *Thread, std::set<uint64_t> const &Entries);
     uintptr_t CompileFallbackBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
+
+    /**
+     * @brief Drops the thread's compiled code for every block generated from guest code in [Address, Address + Size)
+     *
+     * XXX: Other running threads keep their code for the range, their caches can't be touched while they are running
+     */
+    void InvalidateGuestCodeRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, uint64_t Size);
   protected:
     IR::RegisterAllocationPass *GetRegisterAllocatorPass();
 
   private:
     void WaitForIdle();
+    void NotifyThreadIdle();
     FEXCore::Core::InternalThreadState* CreateThread(FEXCore::Core::CPUState *NewThreadState, uint64_t ParentTID, uint64_t ChildTID);
     void *MapRegion(FEXCore::Core::InternalThreadState *Thread, uint64_t Offset, uint64_t Size, bool Fixed = false);
     void *ShmBase();
@@ -123,10 +143,28 @@ namespace FEXCore::Context {
     void CopyMemoryMapping(FEXCore::Core::InternalThreadState *ParentThread, FEXCore::Core::InternalThreadState *ChildThread);
     void InitializeThread(FEXCore::Core::InternalThreadState *Thread);
     void ExecutionThread(FEXCore::Core::InternalThreadState *Thread);
+    void RunGuestThread(FEXCore::Core::InternalThreadState *Thread);
     void RunThread(FEXCore::Core::InternalThreadState *Thread);
     void NotifyPause();
     void HandleExit(FEXCore::Core::InternalThreadState *Thread);
-
+    void DropGuestCodeRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, uint64_t Size);
+    // Drops the IR, debug data, code range, block mapping and backend code of a single RIP
+    void DropBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP);
+    /**
+     * @brief Removes the shared block that the RIP is using
+     * Returns every RIP that was using the shared block, these all need to drop their mapping before the code can be released
+     */
+    std::vector<uint64_t> UnshareBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP);
+    void DumpJITStats();
+
+    bool GenerateIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, FEXCore::IR::IRListView<true> **IRList, FEXCore::Core::DebugData **DebugData, FEXCore::Core::SharedBlock **Shared);
+    /**
+     * @brief Finds the block that shares this IR's contents, adding the IR if there isn't one yet
+     * Returns nullptr if the IR can't be shared
+     */
+    FEXCore::Core::SharedBlock *ShareIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, std::shared_ptr<FEXCore::IR::IRListView<true>> const &IR);
+    // Copies the host code information of a shared block's original RIP in to the debug data of another RIP that shares it
+    void ShareDebugData(FEXCore::Core::InternalThreadState *Thread, FEXCore::Core::SharedBlock const *Shared, FEXCore::Core::DebugData *DebugData);
     uintptr_t AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr);
 
     FEXCore::CodeLoader *LocalLoader{};
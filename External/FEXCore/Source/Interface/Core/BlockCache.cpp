@@ -1,6 +1,7 @@
 #include "Interface/Context/Context.h"
 #include "Interface/Core/Core.h"
 #include "Interface/Core/BlockCache.h"
+#include <cstring>
 #include <sys/mman.h>
 
 namespace FEXCore {
@@ -46,6 +47,22 @@ void BlockCache::HintUsedRange(uint64_t Address, uint64_t Size) {
   madvise(reinterpret_cast<void*>(PagePointer + Address), Size, MADV_WILLNEED);
 }
 
+void BlockCache::EraseRange(uint64_t Address, uint64_t Size) {
+  if (ctx->Config.UnifiedMemory) {
+    Address -= MemoryBase;
+  }
+
+  uint64_t PageBegin = Address >> 12;
+  uint64_t PageEnd = (Address + Size + 0xFFF) >> 12;
+  uintptr_t *Pointers = reinterpret_cast<uintptr_t*>(PagePointer);
+
+  for (uint64_t Page = PageBegin; Page < PageEnd; ++Page) {
+    if (Pointers[Page]) {
+      memset(reinterpret_cast<void*>(Pointers[Page]), 0, SIZE_PER_PAGE);
+    }
+  }
+}
+
 void BlockCache::ClearCache() {
   // Clear out the page memory
   madvise(reinterpret_cast<void*>(PagePointer), ctx->Config.VirtualMemSize / 4096 * 8, MADV_DONTNEED);
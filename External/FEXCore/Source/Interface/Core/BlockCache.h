@@ -17,6 +17,10 @@ public:
   }
 
   void Erase(uint64_t Address) {
+    if (ctx->Config.UnifiedMemory) {
+      Address -= MemoryBase;
+    }
+
     uint64_t PageOffset = Address & (0x0FFF);
     Address >>= 12;
 
@@ -65,6 +69,9 @@ public:
 
   void ClearCache();
 
+  // Removes the mappings of every block that starts in [Address, Address + Size)
+  void EraseRange(uint64_t Address, uint64_t Size);
+
   void HintUsedRange(uint64_t Address, uint64_t Size);
 
   uintptr_t GetPagePointer() { return PagePointer; }
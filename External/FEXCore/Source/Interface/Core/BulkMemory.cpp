@@ -0,0 +1,101 @@
+#include "Interface/Core/BulkMemory.h"
+
+#include <cstring>
+
+namespace FEXCore::CPU::BulkMemory {
+
+template<typename T>
+static void MemSetElements(uint8_t *Dest, T Value, uint64_t Length) {
+  for (uint64_t i = 0; i < Length; ++i) {
+    memcpy(Dest + i * sizeof(T), &Value, sizeof(T));
+  }
+}
+
+void MemSet(void *Dest, uint64_t Value, uint64_t Length, uint64_t Backwards, uint64_t Size) {
+  if (!Length) {
+    return;
+  }
+
+  // Every element gets the same value so we can always fill upwards from the lowest element
+  uint8_t *Start = reinterpret_cast<uint8_t*>(Dest);
+  if (Backwards) {
+    Start -= (Length - 1) * Size;
+  }
+
+  switch (Size) {
+  case 1: memset(Start, Value, Length); break;
+  case 2: MemSetElements<uint16_t>(Start, Value, Length); break;
+  case 4: MemSetElements<uint32_t>(Start, Value, Length); break;
+  case 8: MemSetElements<uint64_t>(Start, Value, Length); break;
+  default: break;
+  }
+}
+
+void MemCpy(void *Dest, void const *Src, uint64_t Length, uint64_t Backwards, uint64_t Size) {
+  if (!Length) {
+    return;
+  }
+
+  uint64_t Bytes = Length * Size;
+  uint8_t *DestPtr = reinterpret_cast<uint8_t*>(Dest);
+  uint8_t const *SrcPtr = reinterpret_cast<uint8_t const*>(Src);
+  uint8_t *DestStart = Backwards ? DestPtr - (Bytes - Size) : DestPtr;
+  uint8_t const *SrcStart = Backwards ? SrcPtr - (Bytes - Size) : SrcPtr;
+
+  bool Overlaps = DestStart < (SrcStart + Bytes) && SrcStart < (DestStart + Bytes);
+  if (!Overlaps) {
+    memcpy(DestStart, SrcStart, Bytes);
+    return;
+  }
+
+  // When walking away from the source every element is read before it gets written, which is what memmove does
+  if (Backwards ? DestPtr >= SrcPtr : DestPtr <= SrcPtr) {
+    memmove(DestStart, SrcStart, Bytes);
+    return;
+  }
+
+  // Otherwise the guest sees its own writes, which is how REP MOVS replicates patterns
+  int64_t Step = Backwards ? -static_cast<int64_t>(Size) : static_cast<int64_t>(Size);
+  for (uint64_t i = 0; i < Length; ++i) {
+    uint64_t Element;
+    memcpy(&Element, SrcPtr, Size);
+    memcpy(DestPtr, &Element, Size);
+    SrcPtr += Step;
+    DestPtr += Step;
+  }
+}
+
+uint64_t MemCmp(void const *Src1, void const *Src2, uint64_t Length, uint64_t Backwards, uint64_t Size, uint64_t StopOnEqual) {
+  uint8_t const *Src1Ptr = reinterpret_cast<uint8_t const*>(Src1);
+  uint8_t const *Src2Ptr = reinterpret_cast<uint8_t const*>(Src2);
+  int64_t Step = Backwards ? -static_cast<int64_t>(Size) : static_cast<int64_t>(Size);
+
+  for (uint64_t i = 0; i < Length; ++i) {
+    bool Equal = memcmp(Src1Ptr, Src2Ptr, Size) == 0;
+    if (Equal == !!StopOnEqual) {
+      return i + 1;
+    }
+    Src1Ptr += Step;
+    Src2Ptr += Step;
+  }
+
+  return Length;
+}
+
+uint64_t MemScan(void const *Src, uint64_t Value, uint64_t Length, uint64_t Backwards, uint64_t Size, uint64_t StopOnEqual) {
+  uint8_t const *SrcPtr = reinterpret_cast<uint8_t const*>(Src);
+  int64_t Step = Backwards ? -static_cast<int64_t>(Size) : static_cast<int64_t>(Size);
+
+  for (uint64_t i = 0; i < Length; ++i) {
+    // Little endian so the start of Value is its lower bytes
+    bool Equal = memcmp(SrcPtr, &Value, Size) == 0;
+    if (Equal == !!StopOnEqual) {
+      return i + 1;
+    }
+    SrcPtr += Step;
+  }
+
+  return Length;
+}
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+
+namespace FEXCore::CPU::BulkMemory {
+
+/**
+ * @name Host implementations of the bulk memory IR ops
+ *
+ * These follow the semantics of the x86 REP string instructions on host pointers.
+ * Pointers point at the first element that gets accessed, if Backwards is set then each following element is Size bytes lower.
+ * Arguments are all 64bit so backends can call these without caring about argument extension.
+ * @{ */
+
+void MemSet(void *Dest, uint64_t Value, uint64_t Length, uint64_t Backwards, uint64_t Size);
+
+/**
+ * @brief Overlapping copies behave like the element by element copy the guest would do
+ */
+void MemCpy(void *Dest, void const *Src, uint64_t Length, uint64_t Backwards, uint64_t Size);
+
+/**
+ * @return Number of elements compared. The last element compared is the one that stopped the compare
+ */
+uint64_t MemCmp(void const *Src1, void const *Src2, uint64_t Length, uint64_t Backwards, uint64_t Size, uint64_t StopOnEqual);
+
+/**
+ * @brief Compares each element against the lower Size bytes of Value
+ *
+ * @return Number of elements compared. The last element compared is the one that stopped the scan
+ */
+uint64_t MemScan(void const *Src, uint64_t Value, uint64_t Length, uint64_t Backwards, uint64_t Size, uint64_t StopOnEqual);
+
+/**  @} */
+
+}
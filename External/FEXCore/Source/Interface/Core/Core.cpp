@@ -20,7 +20,13 @@
 #include <FEXCore/Core/X86Enums.h>
 
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <fstream>
+#include <iterator>
+#include <string_view>
+#include <sys/mman.h>
 
 #include "Interface/Core/GdbServer.h"
 
@@ -124,6 +130,36 @@ namespace DefaultFallbackCore {
 }
 
 namespace FEXCore::Context {
+  /**
+   * @brief The parts of the IR that only depend on the guest code
+   * The IR header holds the RIP the IR was generated at, so it is left out
+   */
+  static std::array<std::string_view, 3> GetSharedIRContents(FEXCore::IR::IRListView<true> const *IR) {
+    uintptr_t ListBegin = IR->GetListData();
+    uintptr_t DataBegin = IR->GetData();
+
+    auto HeaderOp = IR->begin()()->GetNode(ListBegin)->Op(DataBegin);
+    LogMan::Throw::A(HeaderOp->Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
+
+    auto Data = reinterpret_cast<char const*>(DataBegin);
+    auto HeaderBegin = reinterpret_cast<char const*>(HeaderOp);
+    auto HeaderEnd = HeaderBegin + sizeof(FEXCore::IR::IROp_IRHeader);
+
+    return {
+      std::string_view(Data, HeaderBegin - Data),
+      std::string_view(HeaderEnd, (Data + IR->GetDataSize()) - HeaderEnd),
+      std::string_view(reinterpret_cast<char const*>(ListBegin), IR->GetListSize()),
+    };
+  }
+
+  static uint64_t HashSharedIRContents(std::array<std::string_view, 3> const &Contents) {
+    uint64_t Hash{};
+    for (auto const &Part : Contents) {
+      Hash = Hash * 31 + std::hash<std::string_view>{}(Part);
+    }
+    return Hash;
+  }
+
   Context::Context()
     : FrontendDecoder {this}
     , SyscallHandler {this} {
@@ -161,6 +197,10 @@ namespace FEXCore::Context {
   }
 
   void Context::SaveEntryList() {
+    if (!Config.EntryCache) {
+      return;
+    }
+
     std::string const &Filename = SyscallHandler.GetFilename();
     std::string hash_string;
 
@@ -170,7 +210,10 @@ namespace FEXCore::Context {
 
       std::ofstream Output (DataPath.c_str(), std::ios::out | std::ios::binary);
       if (Output.is_open()) {
+        // Stored relative to guest memory so the list stays valid when it ends up somewhere else next run
+        uint64_t GuestBase = Config.UnifiedMemory ? MemoryMapper.GetBaseOffset<uint64_t>(0) : 0;
         for (auto Entry : EntryList) {
+          Entry -= GuestBase;
           Output.write(reinterpret_cast<char const*>(&Entry), sizeof(Entry));
         }
         Output.close();
@@ -198,8 +241,9 @@ namespace FEXCore::Context {
         size_t EntryCount = Size / sizeof(uint64_t);
         uint64_t *Entries = reinterpret_cast<uint64_t*>(&Data.at(0));
 
+        uint64_t GuestBase = Config.UnifiedMemory ? MemoryMapper.GetBaseOffset<uint64_t>(0) : 0;
         for (size_t i = 0; i < EntryCount; ++i) {
-          EntryList.insert(Entries[i]);
+          EntryList.insert(Entries[i] + GuestBase);
         }
       }
     }
@@ -212,6 +256,9 @@ namespace FEXCore::Context {
     {
       std::lock_guard<std::mutex> lk(ThreadCreationMutex);
       for (auto &Thread : Threads) {
+        // Parked host threads see ShouldStop once woken
+        // The event stays signaled, so a thread that is about to park doesn't miss it
+        Thread->ReuseThread.NotifyAll();
         Thread->ExecutionThread.join();
       }
 
@@ -219,6 +266,10 @@ namespace FEXCore::Context {
         AddThreadRIPsToEntryList(Thread);
       }
 
+      if (!Config.JITStatsPath.empty()) {
+        DumpJITStats();
+      }
+
       for (auto &Thread : Threads) {
         delete Thread;
       }
@@ -253,6 +304,8 @@ namespace FEXCore::Context {
     // We are the parent thread
     ParentThread = Thread;
 
+    MemoryMapper.SetHugePages(Config.HugePages);
+
     uintptr_t MemoryBase = MemoryMapper.GetBaseOffset<uintptr_t>(0);
     Loader->SetMemoryBase(MemoryBase, Config.UnifiedMemory);
 
@@ -280,7 +333,13 @@ namespace FEXCore::Context {
       memcpy(reinterpret_cast<void*>(MemoryBase + Addr), Data, Size);
     };
 
-    Loader->LoadMemory(MemoryWriterFunction);
+    auto FileMapperFunction = [&](int FD, uint64_t FileOffset, uint64_t Addr, uint64_t Size) -> bool {
+      // Private file mappings share the page cache until the guest writes to them
+      void *Ptr = mmap(reinterpret_cast<void*>(MemoryBase + Addr), Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, FD, FileOffset);
+      return Ptr != MAP_FAILED;
+    };
+
+    Loader->LoadMappedMemory(MemoryWriterFunction, FileMapperFunction);
     Loader->GetInitLocations(&InitLocations);
 
     auto TLSSlotWriter = [&](void const *Data, uint64_t Size) -> void {
@@ -297,6 +356,10 @@ namespace FEXCore::Context {
     }
     Thread->State.State.rip = StartingRIP = RIP;
 
+    if (Config.EntryCache) {
+      LoadEntryList();
+    }
+
     InitializeThread(Thread);
 
     return true;
@@ -314,35 +377,35 @@ namespace FEXCore::Context {
   }
 
   void Context::WaitForIdle() {
-    do {
-      bool AllPaused = true;
-      {
-        // Grab the mutex lock so a thread doesn't try and spin up while we are waiting
-        for (size_t i = 0; i < Threads.size(); ++i) {
-          if (Threads[i]->State.RunningEvents.Running.load() || Threads[i]->State.RunningEvents.WaitingToStart.load()) {
-            AllPaused = false;
-            break;
-          }
+    // Threads signal IdleWait every time they stop running, so this only wakes up when something changed
+    std::unique_lock<std::mutex> lk(IdleMutex);
+    IdleWait.wait(lk, [this]() {
+      for (size_t i = 0; i < Threads.size(); ++i) {
+        if (Threads[i]->State.RunningEvents.Running.load() || Threads[i]->State.RunningEvents.WaitingToStart.load()) {
+          return false;
         }
       }
-
-      if (AllPaused)
-        break;
-
-      PauseWait.WaitFor(std::chrono::milliseconds(10));
-    } while (true);
+      return true;
+    });
 
     Running = false;
   }
 
+  void Context::NotifyThreadIdle() {
+    // Holding the mutex means WaitForIdle has either not checked the threads yet or is already waiting, so the wakeup can't get lost
+    std::lock_guard<std::mutex> lk(IdleMutex);
+    IdleWait.notify_all();
+  }
+
   void Context::NotifyPause() {
     // Tell all the threads that they should pause
     std::lock_guard<std::mutex> lk(ThreadCreationMutex);
     for (auto &Thread : Threads) {
+      // Parked threads have nothing to pause
+      if (Thread->Exited.load()) {
+        continue;
+      }
       Thread->State.RunningEvents.ShouldPause.store(true);
-    }
-
-    for (auto &Thread : Threads) {
       Thread->StartRunning.NotifyAll();
     }
     Running = true;
@@ -358,12 +421,18 @@ namespace FEXCore::Context {
     // Spin up all the threads
     std::lock_guard<std::mutex> lk(ThreadCreationMutex);
     for (auto &Thread : Threads) {
+      // Parked threads only start again once a new guest thread takes them over
+      if (Thread->Exited.load()) {
+        continue;
+      }
       Thread->State.RunningEvents.ShouldPause.store(false);
       Thread->State.RunningEvents.WaitingToStart.store(true);
     }
 
     for (auto &Thread : Threads) {
-      Thread->StartRunning.NotifyAll();
+      if (!Thread->Exited.load()) {
+        Thread->StartRunning.NotifyAll();
+      }
     }
     Running = true;
   }
@@ -391,18 +460,27 @@ namespace FEXCore::Context {
   }
 
   void Context::InitializeThread(FEXCore::Core::InternalThreadState *Thread) {
-    Thread->CPUBackend->Initialize();
-    Thread->FallbackBackend->Initialize();
-
-    // Compile all of our cached entries
-    LogMan::Msg::D("Precompiling: %ld blocks...", EntryList.size());
-    for (auto Entry : EntryList) {
-      CompileRIP(Thread, Entry);
+    // Recycled thread objects already have warm backends
+    if (!Thread->Initialized) {
+      Thread->CPUBackend->Initialize();
+      Thread->FallbackBackend->Initialize();
+
+      // Compile all of our cached entries
+      // These are compiled as one batch so backends can share the cost of compiling between them
+      LogMan::Msg::D("Precompiling: %ld blocks...", EntryList.size());
+      CompileBlockBatch(Thread, EntryList);
+      LogMan::Msg::D("Done", EntryList.size());
+      Thread->Initialized = true;
     }
-    LogMan::Msg::D("Done", EntryList.size());
 
-    // This will create the execution thread but it won't actually start executing
-    Thread->ExecutionThread = std::thread(&Context::ExecutionThread, this, Thread);
+    if (Thread->ExecutionThread.joinable()) {
+      // Recycled object, wake its parked host thread back up
+      Thread->ReuseThread.NotifyAll();
+    }
+    else {
+      // This will create the execution thread but it won't actually start executing
+      Thread->ExecutionThread = std::thread(&Context::ExecutionThread, this, Thread);
+    }
 
     // Wait for the thread to have started
     Thread->ThreadWaiting.Wait();
@@ -416,18 +494,38 @@ namespace FEXCore::Context {
 
   FEXCore::Core::InternalThreadState* Context::CreateThread(FEXCore::Core::CPUState *NewThreadState, uint64_t ParentTID, uint64_t ChildTID) {
     FEXCore::Core::InternalThreadState *Thread{};
+    bool Recycled = false;
 
     // Grab the new thread object
     {
       std::lock_guard<std::mutex> lk(ThreadCreationMutex);
-      Thread = Threads.emplace_back(new FEXCore::Core::InternalThreadState);
+      // An exited thread's host thread, backends, block cache and compiled code are still valid for this guest so take those over
+      auto it = std::find_if(Threads.begin(), Threads.end(), [](FEXCore::Core::InternalThreadState *Thread) { return Thread->Exited.load(); });
+      if (it != Threads.end()) {
+        Thread = *it;
+        Thread->Exited = false;
+        Thread->State.ThreadManager = FEXCore::HLE::ThreadManagement{};
+        Recycled = true;
+      }
+      else {
+        Thread = Threads.emplace_back(new FEXCore::Core::InternalThreadState);
+      }
       Thread->State.ThreadManager.TID = ++ThreadID;
     }
 
-    Thread->OpDispatcher = std::make_unique<FEXCore::IR::OpDispatchBuilder>();
-    Thread->OpDispatcher->SetMultiblock(Config.Multiblock);
-    Thread->BlockCache = std::make_unique<FEXCore::BlockCache>(this);
-    Thread->CTX = this;
+    if (Recycled) {
+      Thread->State.RunningEvents.Running = false;
+      Thread->State.RunningEvents.ShouldStop = false;
+      Thread->State.RunningEvents.ShouldPause = false;
+      Thread->State.RunningEvents.WaitingToStart = false;
+      Thread->ExitReason = FEXCore::Context::ExitReason::EXIT_WAITING;
+    }
+    else {
+      Thread->OpDispatcher = std::make_unique<FEXCore::IR::OpDispatchBuilder>();
+      Thread->OpDispatcher->SetMultiblock(Config.Multiblock);
+      Thread->BlockCache = std::make_unique<FEXCore::BlockCache>(this);
+      Thread->CTX = this;
+    }
 
     // Copy over the new thread state to the new object
     memcpy(&Thread->State.State, NewThreadState, sizeof(FEXCore::Core::CPUState));
@@ -436,6 +534,10 @@ namespace FEXCore::Context {
     Thread->State.ThreadManager.parent_tid = ParentTID;
     Thread->State.ThreadManager.child_tid = ChildTID;
 
+    if (Recycled) {
+      return Thread;
+    }
+
     // Create CPU backend
     switch (Config.Core) {
     case FEXCore::Config::CONFIG_INTERPRETER: Thread->CPUBackend.reset(FEXCore::CPU::CreateInterpreterCore(this)); break;
@@ -455,7 +557,7 @@ namespace FEXCore::Context {
   IR::RegisterAllocationPass *Context::GetRegisterAllocatorPass() {
     if (!RAPass) {
       RAPass = IR::CreateRegisterAllocationPass();
-      PassManager.InsertPass(RAPass);
+      PassManager.InsertPass(RAPass, "RegisterAllocation");
     }
 
     return RAPass;
@@ -472,8 +574,33 @@ namespace FEXCore::Context {
     return BlockMapPtr;
   }
 
-  uintptr_t Context::CompileBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
-    void *CodePtr {nullptr};
+  void Context::ShareDebugData(FEXCore::Core::InternalThreadState *Thread, FEXCore::Core::SharedBlock const *Shared, FEXCore::Core::DebugData *DebugData) {
+    auto SharedDebugData = Thread->DebugData.find(Shared->RIP);
+    if (DebugData && SharedDebugData != Thread->DebugData.end()) {
+      DebugData->HostCodeSize = SharedDebugData->second.HostCodeSize;
+    }
+  }
+
+  FEXCore::Core::SharedBlock *Context::ShareIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, std::shared_ptr<FEXCore::IR::IRListView<true>> const &IR) {
+    auto Contents = GetSharedIRContents(IR.get());
+    auto Hash = HashSharedIRContents(Contents);
+
+    auto Block = Thread->SharedBlocks.try_emplace(Hash, FEXCore::Core::SharedBlock{IR, GuestRIP, nullptr, {}});
+    auto Shared = &Block.first->second;
+
+    // Hashes can collide, only share the IR if it is actually identical
+    if (!Block.second && Shared->IR != IR && GetSharedIRContents(Shared->IR.get()) != Contents) {
+      return nullptr;
+    }
+
+    if (Thread->SharedBlockHashes.try_emplace(GuestRIP, Hash).second) {
+      Shared->RIPs.emplace_back(GuestRIP);
+    }
+
+    return Shared;
+  }
+
+  bool Context::GenerateIR(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP, FEXCore::IR::IRListView<true> **IRList, FEXCore::Core::DebugData **DebugData, FEXCore::Core::SharedBlock **Shared) {
     uint8_t const *GuestCode{};
     if (Thread->CTX->Config.UnifiedMemory) {
       GuestCode = reinterpret_cast<uint8_t const*>(GuestRIP);
@@ -484,8 +611,18 @@ namespace FEXCore::Context {
 
     // Do we already have this in the IR cache?
     auto IR = Thread->IRLists.find(GuestRIP);
-    FEXCore::IR::IRListView<true> *IRList {};
-    FEXCore::Core::DebugData *DebugData {};
+
+    bool GatherStats = !Config.JITStatsPath.empty();
+    std::chrono::steady_clock::time_point PhaseStart;
+    auto AccumulatePhaseTime = [&](std::atomic_uint64_t *Time) {
+      auto Now = std::chrono::steady_clock::now();
+      Time->fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(Now - PhaseStart).count());
+      PhaseStart = Now;
+    };
+
+    if (GatherStats) {
+      PhaseStart = std::chrono::steady_clock::now();
+    }
 
     if (IR == Thread->IRLists.end()) {
       bool HadDispatchError {false};
@@ -498,11 +635,25 @@ namespace FEXCore::Context {
            LogMan::Msg::E("Had Frontend decoder error");
            ShouldStop = true;
         }
-        return 0;
+        return false;
+      }
+
+      if (GatherStats) {
+        AccumulatePhaseTime(&Thread->Stats.DecodeTime);
       }
 
       auto CodeBlocks = FrontendDecoder.GetDecodedBlocks();
 
+      // Multiblock can decode code before the entry, the whole range needs to be known to invalidate the block
+      FEXCore::Core::GuestCodeRange CodeRange {GuestRIP, GuestRIP};
+      for (auto const &Block : *CodeBlocks) {
+        CodeRange.Begin = std::min(CodeRange.Begin, Block.Entry);
+        for (size_t i = 0; i < Block.NumInstructions; ++i) {
+          auto const &Inst = Block.DecodedInstructions[i];
+          CodeRange.End = std::max(CodeRange.End, Inst.PC + Inst.InstSize);
+        }
+      }
+
       Thread->OpDispatcher->BeginFunction(GuestRIP, CodeBlocks);
 
       for (size_t j = 0; j < CodeBlocks->size(); ++j) {
@@ -546,11 +697,11 @@ namespace FEXCore::Context {
             if (TotalInstructions == 0) {
               // Couldn't handle any instruction in op dispatcher
               Thread->OpDispatcher->ResetWorkingList();
-              return 0;
+              return false;
             }
             else {
               // We had some instructions. Early exit
-              Thread->OpDispatcher->_StoreContext(IR::GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), Thread->OpDispatcher->_Constant(Block.Entry + BlockInstructionsLength));
+              Thread->OpDispatcher->_StoreContext(IR::GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), Thread->OpDispatcher->GetRelocatedPC(Block.Entry + BlockInstructionsLength));
               Thread->OpDispatcher->_ExitFunction();
               break;
             }
@@ -564,8 +715,16 @@ namespace FEXCore::Context {
 
       Thread->OpDispatcher->Finalize();
 
+      if (GatherStats) {
+        AccumulatePhaseTime(&Thread->Stats.DispatchTime);
+      }
+
       // Run the passmanager over the IR from the dispatcher
-      PassManager.Run(Thread->OpDispatcher.get());
+      PassManager.Run(Thread->OpDispatcher.get(), GatherStats ? &Thread->Stats : nullptr);
+
+      if (GatherStats) {
+        AccumulatePhaseTime(&Thread->Stats.PassManagerTime);
+      }
 
       if (Thread->OpDispatcher->ShouldDump) {
         std::stringstream out;
@@ -575,26 +734,72 @@ namespace FEXCore::Context {
       }
 
       // Create a copy of the IR and place it in this thread's IR cache
-      auto AddedIR = Thread->IRLists.try_emplace(GuestRIP, Thread->OpDispatcher->CreateIRCopy());
+      std::shared_ptr<FEXCore::IR::IRListView<true>> NewIR {Thread->OpDispatcher->CreateIRCopy()};
       Thread->OpDispatcher->ResetWorkingList();
 
+      // Identical guest code at another RIP may have already generated this IR
+      *Shared = ShareIR(Thread, GuestRIP, NewIR);
+      if (*Shared) {
+        NewIR = (*Shared)->IR;
+      }
+
+      auto AddedIR = Thread->IRLists.try_emplace(GuestRIP, NewIR);
+
       auto Debugit = Thread->DebugData.try_emplace(GuestRIP);
       Debugit.first->second.GuestCodeSize = TotalInstructionsLength;
       Debugit.first->second.GuestInstructionCount = TotalInstructions;
 
-      IRList = AddedIR.first->second.get();
-      DebugData = &Debugit.first->second;
+      Thread->GuestCodeRanges[GuestRIP] = CodeRange;
+      Thread->MaxGuestCodeRangeSize = std::max(Thread->MaxGuestCodeRangeSize, CodeRange.End - CodeRange.Begin);
+
+      *IRList = AddedIR.first->second.get();
+      *DebugData = &Debugit.first->second;
       Thread->Stats.BlocksCompiled.fetch_add(1);
     }
     else {
-      IRList = IR->second.get();
+      *IRList = IR->second.get();
+      *Shared = ShareIR(Thread, GuestRIP, IR->second);
+      auto Debugit = Thread->DebugData.find(GuestRIP);
+      *DebugData = Debugit != Thread->DebugData.end() ? &Debugit->second : nullptr;
+    }
+
+    return true;
+  }
+
+  uintptr_t Context::CompileBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
+    FEXCore::IR::IRListView<true> *IRList {};
+    FEXCore::Core::DebugData *DebugData {};
+    FEXCore::Core::SharedBlock *Shared {};
+
+    if (!GenerateIR(Thread, GuestRIP, &IRList, &DebugData, &Shared)) {
+      return 0;
+    }
+
+    if (Shared && Shared->CodePtr) {
+      // The code only depends on the IR, so it can run at this RIP as well
+      ShareDebugData(Thread, Shared, DebugData);
+      return AddBlockMapping(Thread, GuestRIP, Shared->CodePtr);
+    }
+
+    bool GatherStats = !Config.JITStatsPath.empty();
+    std::chrono::steady_clock::time_point BackendStart;
+    if (GatherStats) {
+      BackendStart = std::chrono::steady_clock::now();
     }
 
     // Attempt to get the CPU backend to compile this code
-    CodePtr = Thread->CPUBackend->CompileCode(IRList, DebugData);
+    void *CodePtr = Thread->CPUBackend->CompileCode(IRList, DebugData);
+
+    if (GatherStats) {
+      Thread->Stats.BackendTime.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - BackendStart).count());
+    }
 
     if (CodePtr != nullptr) {
       // The core managed to compile the code.
+      if (Shared) {
+        Shared->CodePtr = CodePtr;
+      }
+
 #if ENABLE_JITSYMBOLS
       Symbols.Register(CodePtr, GuestRIP, DebugData->HostCodeSize);
 #endif
@@ -605,6 +810,82 @@ namespace FEXCore::Context {
     return 0;
   }
 
+  void Context::CompileBlockBatch(FEXCore::Core::InternalThreadState *Thread, std::set<uint64_t> const &Entries) {
+    if (!Thread->CPUBackend->HasBatchCompile()) {
+      // Register allocation is only valid for the IR it last ran on, so each block gets compiled right after its IR is generated
+      for (auto Entry : Entries) {
+        CompileBlock(Thread, Entry);
+      }
+      return;
+    }
+
+    std::vector<FEXCore::CPU::CPUBackend::BatchBlock> Blocks;
+    std::vector<uint64_t> BlockRIPs;
+    std::vector<FEXCore::Core::SharedBlock*> BlockShares;
+    // Entries that share IR with a block in this batch get mapped once it is compiled
+    std::vector<std::pair<uint64_t, FEXCore::Core::SharedBlock*>> SharedEntries;
+
+    for (auto Entry : Entries) {
+      FEXCore::IR::IRListView<true> *IRList {};
+      FEXCore::Core::DebugData *DebugData {};
+      FEXCore::Core::SharedBlock *Shared {};
+
+      if (GenerateIR(Thread, Entry, &IRList, &DebugData, &Shared)) {
+        if (Shared && Shared->CodePtr) {
+          ShareDebugData(Thread, Shared, DebugData);
+          AddBlockMapping(Thread, Entry, Shared->CodePtr);
+          continue;
+        }
+
+        if (Shared && std::find(BlockShares.begin(), BlockShares.end(), Shared) != BlockShares.end()) {
+          SharedEntries.emplace_back(Entry, Shared);
+          continue;
+        }
+
+        Blocks.emplace_back(FEXCore::CPU::CPUBackend::BatchBlock{IRList, DebugData, nullptr});
+        BlockRIPs.emplace_back(Entry);
+        BlockShares.emplace_back(Shared);
+      }
+    }
+
+    bool GatherStats = !Config.JITStatsPath.empty();
+    std::chrono::steady_clock::time_point BackendStart;
+    if (GatherStats) {
+      BackendStart = std::chrono::steady_clock::now();
+    }
+
+    Thread->CPUBackend->CompileCodeBatch(Blocks);
+
+    if (GatherStats) {
+      Thread->Stats.BackendTime.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - BackendStart).count());
+    }
+
+    for (size_t i = 0; i < Blocks.size(); ++i) {
+      if (Blocks[i].CodePtr == nullptr) {
+        // Will get compiled on its own if it ever gets executed
+        continue;
+      }
+
+      if (BlockShares[i]) {
+        BlockShares[i]->CodePtr = Blocks[i].CodePtr;
+      }
+
+#if ENABLE_JITSYMBOLS
+      Symbols.Register(Blocks[i].CodePtr, BlockRIPs[i], Blocks[i].DebugData->HostCodeSize);
+#endif
+
+      AddBlockMapping(Thread, BlockRIPs[i], Blocks[i].CodePtr);
+    }
+
+    for (auto &Entry : SharedEntries) {
+      if (Entry.second->CodePtr) {
+        auto DebugData = Thread->DebugData.find(Entry.first);
+        ShareDebugData(Thread, Entry.second, DebugData != Thread->DebugData.end() ? &DebugData->second : nullptr);
+        AddBlockMapping(Thread, Entry.first, Entry.second->CodePtr);
+      }
+    }
+  }
+
   using BlockFn = void (*)(FEXCore::Core::InternalThreadState *Thread);
   uintptr_t Context::CompileFallbackBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP) {
     // We have ONE more chance to try and fallback to the fallback CPU backend
@@ -620,7 +901,7 @@ namespace FEXCore::Context {
   }
 
   void Context::HandleExit(FEXCore::Core::InternalThreadState *thread) {
-    PauseWait.NotifyAll();
+    NotifyThreadIdle();
 
     // The first thread here gets to handle the exit.
     // If a thread is exiting due to error or debug, it will be the first thread here
@@ -646,6 +927,25 @@ namespace FEXCore::Context {
   }
 
   void Context::ExecutionThread(FEXCore::Core::InternalThreadState *Thread) {
+    while (true) {
+      RunGuestThread(Thread);
+
+      // Only a guest thread that exited by itself can hand its host thread to a new guest thread
+      if (ShouldStop.load() || !Thread->State.RunningEvents.ShouldStop.load()) {
+        break;
+      }
+
+      // Park until CreateThread hands this object and host thread to a new guest thread
+      Thread->Exited = true;
+      Thread->ReuseThread.Wait();
+
+      if (ShouldStop.load()) {
+        break;
+      }
+    }
+  }
+
+  void Context::RunGuestThread(FEXCore::Core::InternalThreadState *Thread) {
     Thread->ExitReason = FEXCore::Context::ExitReason::EXIT_WAITING;
 
     Thread->ThreadWaiting.NotifyAll();
@@ -656,6 +956,7 @@ namespace FEXCore::Context {
       Thread->State.RunningEvents.ShouldStop.store(true);
       Thread->State.RunningEvents.Running.store(false);
       Thread->ExitReason = FEXCore::Context::ExitReason::EXIT_SHUTDOWN;
+      NotifyThreadIdle();
       return;
     }
 
@@ -815,6 +1116,7 @@ namespace FEXCore::Context {
 
     Thread->State.RunningEvents.WaitingToStart = false;
     Thread->State.RunningEvents.Running = false;
+    NotifyThreadIdle();
   }
 
   // Debug interface
@@ -823,9 +1125,11 @@ namespace FEXCore::Context {
     Thread->State.State.rip = RIP;
 
     // Erase the RIP from all the storage backings if it exists
-    Thread->IRLists.erase(RIP);
-    Thread->DebugData.erase(RIP);
-    Thread->BlockCache->Erase(RIP);
+    // Every RIP sharing the block's code has to drop it as well, since the backend releases the code on recompile
+    for (auto Alias : UnshareBlock(Thread, RIP)) {
+      DropBlock(Thread, Alias);
+    }
+    DropBlock(Thread, RIP);
 
     // We don't care if compilation passes or not
     CompileBlock(Thread, RIP);
@@ -833,6 +1137,92 @@ namespace FEXCore::Context {
     Thread->State.State.rip = RIPBackup;
   }
 
+  void Context::InvalidateGuestCodeRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, uint64_t Size) {
+    DropGuestCodeRange(Thread, Address, Size);
+
+    // Exited threads aren't running anything, so their code can be dropped before a new thread takes them over
+    std::lock_guard<std::mutex> lk(ThreadCreationMutex);
+    for (auto &ExitedThread : Threads) {
+      if (ExitedThread != Thread && ExitedThread->Exited.load()) {
+        DropGuestCodeRange(ExitedThread, Address, Size);
+      }
+    }
+  }
+
+  void Context::DropGuestCodeRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, uint64_t Size) {
+    uint64_t End = Address + Size;
+    auto InRange = [Address, End](uint64_t RIP) {
+      return RIP >= Address && RIP < End;
+    };
+
+    // A block's RIP is inside of its code range, so an overlapping block can't have its RIP further away than the largest range
+    uint64_t SearchBegin = Address > Thread->MaxGuestCodeRangeSize ? Address - Thread->MaxGuestCodeRangeSize : 0;
+    uint64_t SearchEnd = End + Thread->MaxGuestCodeRangeSize;
+
+    std::vector<uint64_t> Overlapping;
+    for (auto it = Thread->GuestCodeRanges.lower_bound(SearchBegin); it != Thread->GuestCodeRanges.end() && it->first < SearchEnd; ++it) {
+      if (it->second.Begin < End && it->second.End > Address) {
+        Overlapping.emplace_back(it->first);
+      }
+    }
+
+    if (Overlapping.empty()) {
+      // Nothing was ever compiled from this range
+      return;
+    }
+
+    std::vector<uint64_t> OutsideRange;
+    for (auto RIP : Overlapping) {
+      // Shared code goes away as a unit, RIPs elsewhere that were running it can't keep it
+      auto Aliases = UnshareBlock(Thread, RIP);
+      std::copy_if(Aliases.begin(), Aliases.end(), std::back_inserter(OutsideRange), [&](uint64_t Alias) { return !InRange(Alias); });
+
+      if (InRange(RIP)) {
+        Thread->IRLists.erase(RIP);
+        Thread->DebugData.erase(RIP);
+        Thread->GuestCodeRanges.erase(RIP);
+      }
+      else {
+        OutsideRange.emplace_back(RIP);
+      }
+    }
+
+    Thread->BlockCache->EraseRange(Address, Size);
+    Thread->CPUBackend->InvalidateGuestCodeRange(Address, Size);
+    Thread->FallbackBackend->InvalidateGuestCodeRange(Address, Size);
+
+    // Blocks that start outside of the range only get found through their code range, the backends need to be told about each of them
+    for (auto RIP : OutsideRange) {
+      DropBlock(Thread, RIP);
+    }
+  }
+
+  void Context::DropBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP) {
+    Thread->IRLists.erase(RIP);
+    Thread->DebugData.erase(RIP);
+    Thread->GuestCodeRanges.erase(RIP);
+    Thread->BlockCache->Erase(RIP);
+    Thread->CPUBackend->InvalidateGuestCodeRange(RIP, 1);
+    Thread->FallbackBackend->InvalidateGuestCodeRange(RIP, 1);
+  }
+
+  std::vector<uint64_t> Context::UnshareBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t RIP) {
+    auto Hash = Thread->SharedBlockHashes.find(RIP);
+    if (Hash == Thread->SharedBlockHashes.end()) {
+      return {};
+    }
+
+    auto Shared = Thread->SharedBlocks.find(Hash->second);
+    std::vector<uint64_t> RIPs = std::move(Shared->second.RIPs);
+    Thread->SharedBlocks.erase(Shared);
+
+    for (auto Alias : RIPs) {
+      Thread->SharedBlockHashes.erase(Alias);
+    }
+
+    return RIPs;
+  }
+
   void *Context::MapRegion(FEXCore::Core::InternalThreadState *Thread, uint64_t Offset, uint64_t Size, bool Fixed) {
     void *Ptr = MemoryMapper.MapRegion(Offset, Size, Fixed);
     Thread->CPUBackend->MapRegion(Ptr, Offset, Size);
@@ -850,13 +1240,44 @@ namespace FEXCore::Context {
   }
 
   void Context::CopyMemoryMapping([[maybe_unused]] FEXCore::Core::InternalThreadState*, FEXCore::Core::InternalThreadState *ChildThread) {
+    std::shared_lock<std::shared_mutex> lk(MemoryMapper.RegionMutex);
     auto Regions = MemoryMapper.MappedRegions;
-    for (auto const& Region : Regions) {
+    lk.unlock();
+    for (auto const& [Offset, Region] : Regions) {
       ChildThread->CPUBackend->MapRegion(Region.Ptr, Region.Offset, Region.Size);
       ChildThread->FallbackBackend->MapRegion(Region.Ptr, Region.Offset, Region.Size);
     }
   }
 
+  void Context::DumpJITStats() {
+    FILE *fp = fopen(Config.JITStatsPath.c_str(), "w");
+    if (!fp) {
+      LogMan::Msg::E("Couldn't open JIT stats file '%s'", Config.JITStatsPath.c_str());
+      return;
+    }
+
+    fprintf(fp, "{\n  \"Threads\": [");
+    for (size_t i = 0; i < Threads.size(); ++i) {
+      auto const &Stats = Threads[i]->Stats;
+      fprintf(fp, "%s\n    {\n", i ? "," : "");
+      fprintf(fp, "      \"TID\": %ld,\n", Threads[i]->State.ThreadManager.TID);
+      fprintf(fp, "      \"BlocksCompiled\": %ld,\n", Stats.BlocksCompiled.load());
+      fprintf(fp, "      \"DecodeTime\": %ld,\n", Stats.DecodeTime.load());
+      fprintf(fp, "      \"DispatchTime\": %ld,\n", Stats.DispatchTime.load());
+      fprintf(fp, "      \"PassManagerTime\": %ld,\n", Stats.PassManagerTime.load());
+      fprintf(fp, "      \"BackendTime\": %ld,\n", Stats.BackendTime.load());
+      fprintf(fp, "      \"Passes\": [");
+      for (size_t j = 0; j < Stats.Passes.size(); ++j) {
+        auto const &Pass = Stats.Passes[j];
+        fprintf(fp, "%s\n        {\"Name\": \"%s\", \"Runs\": %ld, \"Time\": %ld, \"NodesBefore\": %ld, \"NodesAfter\": %ld}",
+          j ? "," : "", Pass.Name.c_str(), Pass.Runs, Pass.Time, Pass.NodesBefore, Pass.NodesAfter);
+      }
+      fprintf(fp, "%s]\n    }", Stats.Passes.empty() ? "" : "\n      ");
+    }
+    fprintf(fp, "%s]\n}\n", Threads.empty() ? "" : "\n  ");
+    fclose(fp);
+  }
+
   uint64_t Context::GetThreadCount() const {
     return Threads.size();
   }
@@ -871,8 +1292,11 @@ namespace FEXCore::Context {
 
   void Context::GetMemoryRegions(std::vector<FEXCore::Memory::MemRegion> *Regions) {
     Regions->clear();
-    Regions->resize(MemoryMapper.MappedRegions.size());
-    memcpy(&Regions->at(0), &MemoryMapper.MappedRegions.at(0), sizeof(FEXCore::Memory::MemRegion) * MemoryMapper.MappedRegions.size());
+    std::shared_lock<std::shared_mutex> lk(MemoryMapper.RegionMutex);
+    Regions->reserve(MemoryMapper.MappedRegions.size());
+    for (auto const& [Offset, Region] : MemoryMapper.MappedRegions) {
+      Regions->emplace_back(Region);
+    }
   }
 
   bool Context::GetDebugDataForRIP(uint64_t RIP, FEXCore::Core::DebugData *Data) {
@@ -1,6 +1,7 @@
 #include "LogManager.h"
 #include "Common/MathUtils.h"
 #include "Interface/Context/Context.h"
+#include "Interface/Core/BulkMemory.h"
 #include "Interface/Core/DebugData.h"
 #include "Interface/Core/InternalThreadState.h"
 #include "Interface/HLE/Syscalls.h"
@@ -10,19 +11,44 @@
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace FEXCore::CPU {
 
-#define DESTMAP_AS_MAP 0
-#if DESTMAP_AS_MAP
-using DestMapType = std::unordered_map<uint32_t, uint32_t>;
-#else
-using DestMapType = std::vector<uint32_t>;
-#endif
+/**
+ * @brief A single op of a translated block
+ *
+ * Everything that can be worked out ahead of time is, so executing an op doesn't need to touch the IR list
+ */
+struct InterpreterOp {
+  // Label address of the op's handler, resolved the first time the program runs
+  void const *Handler;
+  FEXCore::IR::IROp_Header *IROp;
+  // Offset of the op's destination in the temporary space
+  uint32_t Dest;
+  // Op indices that JUMP and CONDJUMP continue at
+  uint32_t Targets[2];
+};
+
+/**
+ * @brief Linear form of a block's IR
+ *
+ * Code blocks are laid out in IR order so falling off the end of one block continues in to the next
+ * The final op is a sentinel that leaves the program
+ */
+struct InterpreterProgram {
+  std::vector<InterpreterOp> Ops;
+  // Temporary space offset of every SSA node
+  std::vector<uint32_t> Slots;
+  size_t TmpSize;
+  bool HandlersResolved;
+};
 
 class InterpreterCore final : public CPUBackend {
 public:
@@ -35,22 +61,29 @@ public:
 
   bool NeedsOpDispatch() override { return true; }
 
+  void InvalidateGuestCodeRange(uint64_t Address, uint64_t Size) override;
+
   void ExecuteCode(FEXCore::Core::InternalThreadState *Thread);
 private:
   FEXCore::Context::Context *CTX;
-  uint32_t AllocateTmpSpace(size_t Size);
 
-  template<typename Res>
-  Res GetDest(IR::OrderedNodeWrapper Op);
+  InterpreterProgram *TranslateIR(FEXCore::IR::IRListView<true> const *IR);
 
   template<typename Res>
   Res GetSrc(IR::OrderedNodeWrapper Src);
 
   std::vector<uint8_t> TmpSpace;
-  DestMapType DestMap;
-  size_t TmpOffset{};
+  uint32_t const *CurrentSlots{};
+
+  // Translated programs keyed by guest RIP
+  std::unordered_map<uint64_t, std::shared_ptr<InterpreterProgram>> Programs;
+  // Translated programs keyed by the RIP their IR was generated at, lets guest RIPs that share IR share the program as well
+  // IR pointers can't be used as the key since a new IR can end up at the address of a released one
+  std::unordered_map<uint64_t, std::shared_ptr<InterpreterProgram>> ProgramsByEntry;
 
-  FEXCore::IR::IRListView<true> *CurrentIR;
+  // Handler label for every IR op. Labels only exist inside of ExecuteCode so this gets filled on the first execution
+  std::array<void const*, FEXCore::IR::OP_LAST + 1> DispatchTable;
+  bool DispatchTableInitialized{};
 };
 
 static void InterpreterExecution(FEXCore::Core::InternalThreadState *Thread) {
@@ -62,3159 +95,3560 @@ InterpreterCore::InterpreterCore(FEXCore::Context::Context *ctx)
   : CTX {ctx} {
   // Grab our space for temporary data
   TmpSpace.resize(4096 * 32);
-#if !DESTMAP_AS_MAP
-  DestMap.resize(4096);
-#endif
-}
-
-uint32_t InterpreterCore::AllocateTmpSpace(size_t Size) {
-  // XXX: IR generation has a bug where the size can periodically end up being zero
-  // LogMan::Throw::A(Size !=0, "Dest Op had zero destination size");
-  Size = Size < 16 ? 16 : Size;
-
-  // Force alignment by size
-  size_t NewBase = AlignUp(TmpOffset, Size);
-  size_t NewEnd = NewBase + Size;
-
-  if (NewEnd >= TmpSpace.size()) {
-    // If we are going to overrun the end of our temporary space then double the size of it
-    TmpSpace.resize(TmpSpace.size() * 2);
-  }
-
-  // Make sure to set the new offset
-  TmpOffset = NewEnd;
-
-  return NewBase;
-}
-
-template<typename Res>
-Res InterpreterCore::GetDest(IR::OrderedNodeWrapper Op) {
-  auto DstPtr = &TmpSpace.at(DestMap[Op.ID()]);
-  return reinterpret_cast<Res>(DstPtr);
 }
 
 template<typename Res>
 Res InterpreterCore::GetSrc(IR::OrderedNodeWrapper Src) {
-#if DESTMAP_AS_MAP
-  LogMan::Throw::A(DestMap.find(Src.ID()) != DestMap.end(), "Op had source but it wasn't in the destination map");
-#endif
-
-  auto DstPtr = &TmpSpace.at(DestMap[Src.ID()]);
-  LogMan::Throw::A(DstPtr != nullptr, "Destmap had slot but didn't get allocated memory");
+  auto DstPtr = &TmpSpace[CurrentSlots[Src.ID()]];
   return reinterpret_cast<Res>(DstPtr);
 }
 
-void *InterpreterCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData) {
-  return reinterpret_cast<void*>(InterpreterExecution);
+static uint64_t GetIREntry(FEXCore::IR::IRListView<true> const *IR) {
+  auto HeaderIterator = IR->begin();
+  IR::OrderedNodeWrapper *HeaderNodeWrapper = HeaderIterator();
+  IR::OrderedNode *HeaderNode = HeaderNodeWrapper->GetNode(IR->GetListData());
+  return HeaderNode->Op(IR->GetData())->C<FEXCore::IR::IROp_IRHeader>()->Entry;
 }
 
-void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
-  auto IR = Thread->IRLists.find(Thread->State.State.rip);
-  auto DebugData = Thread->DebugData.find(Thread->State.State.rip);
-  CurrentIR = IR->second.get();
+static void *GetMemoryPointer(FEXCore::Core::InternalThreadState *Thread, uint64_t Addr) {
+  if (Thread->CTX->Config.UnifiedMemory) {
+    return reinterpret_cast<void*>(Addr);
+  }
 
-  TmpOffset = 0; // Reset where we are in the temp data range
+  void *Data = Thread->CTX->MemoryMapper.GetPointer<void*>(Addr);
+  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", Addr);
+  return Data;
+}
 
-  uintptr_t ListBegin = CurrentIR->GetListData();
-  uintptr_t DataBegin = CurrentIR->GetData();
+InterpreterProgram *InterpreterCore::TranslateIR(FEXCore::IR::IRListView<true> const *IR) {
+  using namespace FEXCore::IR;
 
-#if DESTMAP_AS_MAP
-  DestMap.clear();
-#else
-  uintptr_t ListSize = CurrentIR->GetSSACount();
-  if (ListSize > DestMap.size()) {
-    DestMap.resize(std::max(DestMap.size() * 2, ListSize));
-  }
-#endif
+  uintptr_t ListBegin = IR->GetListData();
+  uintptr_t DataBegin = IR->GetData();
 
   static_assert(sizeof(FEXCore::IR::IROp_Header) == 4);
   static_assert(sizeof(FEXCore::IR::OrderedNode) == 16);
 
-  auto HeaderIterator = CurrentIR->begin();
+  auto HeaderIterator = IR->begin();
   IR::OrderedNodeWrapper *HeaderNodeWrapper = HeaderIterator();
   IR::OrderedNode *HeaderNode = HeaderNodeWrapper->GetNode(ListBegin);
   auto HeaderOp = HeaderNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
   LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
 
-  IR::OrderedNode const *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+  auto Program = std::make_unique<InterpreterProgram>();
+  Program->Slots.resize(IR->GetSSACount());
+  Program->HandlersResolved = false;
+
+  // Op index of the first op in each block, indexed by the block's node ID
+  std::vector<uint32_t> BlockStart(IR->GetSSACount());
 
-#define GD *GetDest<uint64_t*>(*WrapperOp)
-#define GDP GetDest<void*>(*WrapperOp)
+  // The first slot is scratch space for ops that don't have a destination
+  size_t TmpOffset = 16;
+
+  IR::OrderedNodeWrapper BlockWrapper = HeaderOp->Blocks;
 
   while (1) {
-    using namespace FEXCore::IR;
-    auto BlockIROp = BlockNode->Op(DataBegin)->C<FEXCore::IR::IROp_CodeBlock>();
+    auto BlockIROp = BlockWrapper.GetNode(ListBegin)->Op(DataBegin)->C<FEXCore::IR::IROp_CodeBlock>();
     LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
 
+    BlockStart[BlockWrapper.ID()] = Program->Ops.size();
+
     // We grab these nodes this way so we can iterate easily
-    auto CodeBegin = CurrentIR->at(BlockIROp->Begin);
-    auto CodeLast = CurrentIR->at(BlockIROp->Last);
-    struct {
-      bool Quit;
-      bool Redo;
-    } BlockResults{};
-
-    auto HandleBlock = [&]() {
-      while (1) {
-        OrderedNodeWrapper *WrapperOp = CodeBegin();
-        OrderedNode *RealNode = WrapperOp->GetNode(ListBegin);
-        FEXCore::IR::IROp_Header *IROp = RealNode->Op(DataBegin);
-        uint8_t OpSize = IROp->Size;
-        uint32_t Node = WrapperOp->ID();
-
-        if (IROp->HasDest) {
-          uint64_t AllocSize = OpSize * std::max(static_cast<uint8_t>(1), IROp->Elements);
-          DestMap[Node] = AllocateTmpSpace(AllocSize);
-          // Clear any previous results
-          memset(GDP, 0, 16);
-        }
-
-        switch (IROp->Op) {
-          case IR::OP_DUMMY:
-          case IR::OP_BEGINBLOCK:
-            break;
-          case IR::OP_ENDBLOCK: {
-            auto Op = IROp->C<IR::IROp_EndBlock>();
-            Thread->State.State.rip += Op->RIPIncrement;
-            break;
-          }
-          case IR::OP_EXITFUNCTION:
-            BlockResults.Quit = true;
-            return;
-            break;
-          case IR::OP_CONDJUMP: {
-            auto Op = IROp->C<IR::IROp_CondJump>();
-            uint64_t Arg = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            if (!!Arg) {
-              BlockNode = Op->Header.Args[1].GetNode(ListBegin);
-            }
-            else  {
-              BlockNode = Op->Header.Args[2].GetNode(ListBegin);
-            }
-            BlockResults.Redo = true;
-            return;
-            break;
-          }
-          case IR::OP_JUMP: {
-            auto Op = IROp->C<IR::IROp_Jump>();
-            BlockNode = Op->Header.Args[0].GetNode(ListBegin);
-            BlockResults.Redo = true;
-            return;
-            break;
-          }
-          case IR::OP_BREAK: {
-            auto Op = IROp->C<IR::IROp_Break>();
-            switch (Op->Reason) {
-              case 4: // HLT
-                Thread->State.RunningEvents.ShouldStop = true;
-                BlockResults.Quit = true;
-                return;
-              break;
-            default: LogMan::Msg::A("Unknown Break Reason: %d", Op->Reason); break;
-            }
-            break;
-          }
-          case IR::OP_SYSCALL: {
-            auto Op = IROp->C<IR::IROp_Syscall>();
-
-            FEXCore::HLE::SyscallArguments Args;
-            for (size_t j = 0; j < 7; ++j)
-              Args.Argument[j] = *GetSrc<uint64_t*>(Op->Header.Args[j]);
-
-            uint64_t Res = CTX->SyscallHandler.HandleSyscall(Thread, &Args);
-            GD = Res;
-            break;
-          }
-          case IR::OP_CPUID: {
-            auto Op = IROp->C<IR::IROp_CPUID>();
-            uint64_t *DstPtr = GetDest<uint64_t*>(*WrapperOp);
-            uint64_t Arg = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-
-            auto Results = CTX->CPUID.RunFunction(Arg);
-            memcpy(DstPtr, &Results.Res, sizeof(uint32_t) * 4);
-            break;
-          }
-          case IR::OP_PRINT: {
-            auto Op = IROp->C<IR::IROp_Print>();
-
-            if (OpSize <= 8) {
-              uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-              LogMan::Msg::I(">>>> Value in Arg: 0x%lx, %ld", Src, Src);
-            }
-            else if (OpSize == 16) {
-              __uint128_t Src = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-              uint64_t Src0 = Src;
-              uint64_t Src1 = Src >> 64;
-              LogMan::Msg::I(">>>> Value[0] in Arg: 0x%lx, %ld", Src0, Src0);
-              LogMan::Msg::I("     Value[1] in Arg: 0x%lx, %ld", Src1, Src1);
-            }
-            else
-              LogMan::Msg::A("Unknown value size: %d", OpSize);
-            break;
-          }
-          case IR::OP_CYCLECOUNTER: {
-            #ifdef DEBUG_CYCLES
-              GD = 0;
-            #else
-              timespec time;
-              clock_gettime(CLOCK_REALTIME, &time);
-              GD = time.tv_nsec + time.tv_sec * 1000000000;
-            #endif
-            break;
-          }
-          case IR::OP_MOV: {
-            auto Op = IROp->C<IR::IROp_Mov>();
-            memcpy(GDP, GetSrc<void*>(Op->Header.Args[0]), OpSize);
-            break;
-          }
-          case IR::OP_VBITCAST: {
-            auto Op = IROp->C<IR::IROp_VBitcast>();
-            memcpy(GDP, GetSrc<void*>(Op->Header.Args[0]), 16);
-            break;
-          }
-          case IR::OP_VCASTFROMGPR: {
-            auto Op = IROp->C<IR::IROp_VCastFromGPR>();
-            memcpy(GDP, GetSrc<void*>(Op->Header.Args[0]), Op->ElementSize);
-            break;
-          }
-          case IR::OP_VEXTRACTTOGPR: {
-            auto Op = IROp->C<IR::IROp_VExtractToGPR>();
-            LogMan::Throw::A(Op->RegisterSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
-            if (Op->RegisterSize == 16) {
-              __uint128_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
-              uint64_t Shift = Op->ElementSize * Op->Idx * 8;
-              if (Op->ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              __uint128_t Src = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              memcpy(GDP, &Src, Op->ElementSize);
-            }
-            else {
-              uint64_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
-              uint64_t Shift = Op->ElementSize * Op->Idx * 8;
-              if (Op->ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              GD = Src;
-            }
-            break;
-          }
-
-          case IR::OP_CONSTANT: {
-            auto Op = IROp->C<IR::IROp_Constant>();
-            GD = Op->Constant;
-            break;
-          }
-          case IR::OP_LOADCONTEXT: {
-            auto Op = IROp->C<IR::IROp_LoadContext>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->Offset;
-            #define LOAD_CTX(x, y) \
-              case x: { \
-                y const *Data = reinterpret_cast<y const*>(ContextPtr); \
-                GD = *Data; \
-                break; \
-              }
-            switch (Op->Size) {
-              LOAD_CTX(1, uint8_t)
-              LOAD_CTX(2, uint16_t)
-              LOAD_CTX(4, uint32_t)
-              LOAD_CTX(8, uint64_t)
-              case 16: {
-                void const *Data = reinterpret_cast<void const*>(ContextPtr);
-                memcpy(GDP, Data, Op->Size);
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled LoadContext size: %d", Op->Size);
-            }
-            #undef LOAD_CTX
-            break;
-          }
-          case IR::OP_LOADCONTEXTINDEXED: {
-            auto Op = IROp->C<IR::IROp_LoadContextIndexed>();
-            uint64_t Index = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->BaseOffset;
-            ContextPtr += Index * Op->Stride;
-
-            #define LOAD_CTX(x, y) \
-              case x: { \
-                y const *Data = reinterpret_cast<y const*>(ContextPtr); \
-                GD = *Data; \
-                break; \
-              }
-            switch (Op->Size) {
-              LOAD_CTX(1, uint8_t)
-              LOAD_CTX(2, uint16_t)
-              LOAD_CTX(4, uint32_t)
-              LOAD_CTX(8, uint64_t)
-              case 16: {
-                void const *Data = reinterpret_cast<void const*>(ContextPtr);
-                memcpy(GDP, Data, Op->Size);
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled LoadContextIndexed size: %d", Op->Size);
-            }
-            #undef LOAD_CTX
-            break;
-          }
-          case IR::OP_STORECONTEXT: {
-            auto Op = IROp->C<IR::IROp_StoreContext>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->Offset;
-
-            void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            memcpy(Data, Src, Op->Size);
-            break;
-          }
-          case IR::OP_STORECONTEXTINDEXED: {
-            auto Op = IROp->C<IR::IROp_StoreContextIndexed>();
-            uint64_t Index = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->BaseOffset;
-            ContextPtr += Index * Op->Stride;
-
-            void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            memcpy(Data, Src, Op->Size);
-            break;
-          }
-          case IR::OP_LOADFLAG: {
-            auto Op = IROp->C<IR::IROp_LoadFlag>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
-            ContextPtr += Op->Flag;
-            uint8_t const *Data = reinterpret_cast<uint8_t const*>(ContextPtr);
-            GD = *Data;
-            break;
-          }
-          case IR::OP_STOREFLAG: {
-            auto Op = IROp->C<IR::IROp_StoreFlag>();
-            uint8_t Arg = *GetSrc<uint8_t*>(Op->Header.Args[0]) & 1;
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
-            ContextPtr += Op->Flag;
-            uint8_t *Data = reinterpret_cast<uint8_t*>(ContextPtr);
-            *Data = Arg;
-            break;
-          }
-          case IR::OP_LOADMEM: {
-            auto Op = IROp->C<IR::IROp_LoadMem>();
-            void const *Data{};
-            if (Thread->CTX->Config.UnifiedMemory) {
-              Data = *GetSrc<void const**>(Op->Header.Args[0]);
-            }
-            else {
-              Data = Thread->CTX->MemoryMapper.GetPointer<void const*>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-              LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-            }
-            memcpy(GDP, Data, OpSize);
-            break;
-          }
-          case IR::OP_STOREMEM: {
-            #define STORE_DATA(x, y) \
-              case x: { \
-                y *Data{}; \
-                if (Thread->CTX->Config.UnifiedMemory) { \
-                  Data = *GetSrc<y**>(Op->Header.Args[0]); \
-                } \
-                else { \
-                  Data = Thread->CTX->MemoryMapper.GetPointer<y*>(*GetSrc<uint64_t*>(Op->Header.Args[0])); \
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0])); \
-                } \
-                memcpy(Data, GetSrc<y*>(Op->Header.Args[1]), sizeof(y)); \
-                break; \
-              }
-
-            auto Op = IROp->C<IR::IROp_StoreMem>();
-
-            switch (Op->Size) {
-              STORE_DATA(1, uint8_t)
-              STORE_DATA(2, uint16_t)
-              STORE_DATA(4, uint32_t)
-              STORE_DATA(8, uint64_t)
-              case 16: {
-                void *Data{};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<void**>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<void*>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-
-                void *Src = GetSrc<void*>(Op->Header.Args[1]);
-                memcpy(Data, Src, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unhandled StoreMem size"); break;
-            }
-            #undef STORE_DATA
-            break;
-          }
-          #define DO_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(GDP);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            *Dst_d = func(*Src1_d, *Src2_d);          \
-            break;                                            \
-            }
-
-          case IR::OP_ADD: {
-            auto Op = IROp->C<IR::IROp_Add>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a + b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_SUB: {
-            auto Op = IROp->C<IR::IROp_Sub>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a - b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_OR: {
-            auto Op = IROp->C<IR::IROp_Or>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a | b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              DO_OP(16, __uint128_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_AND: {
-            auto Op = IROp->C<IR::IROp_And>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a & b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_XOR: {
-            auto Op = IROp->C<IR::IROp_Xor>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a ^ b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LSHL: {
-            auto Op = IROp->C<IR::IROp_Lshl>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            uint8_t Mask = OpSize * 8 - 1;
-            GD = Src1 << (Src2 & Mask);
-            break;
-          }
-          case IR::OP_LSHR: {
-            auto Op = IROp->C<IR::IROp_Lshr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            uint8_t Mask = OpSize * 8 - 1;
-            GD = Src1 >> (Src2 & Mask);
-            break;
-          }
-          case IR::OP_ASHR: {
-            auto Op = IROp->C<IR::IROp_Ashr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            uint8_t Mask = OpSize * 8 - 1;
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int8_t>(Src1) >> (Src2 & Mask);
-                break;
-              case 2:
-                GD = static_cast<int16_t>(Src1) >> (Src2 & Mask);
-                break;
-              case 4:
-                GD = static_cast<int32_t>(Src1) >> (Src2 & Mask);
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) >> (Src2 & Mask);
-                break;
-              default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
-            };
-            break;
-          }
-          case IR::OP_ROR: {
-            auto Op = IROp->C<IR::IROp_Ror>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            auto Ror = [] (auto In, auto R) {
-            auto RotateMask = sizeof(In) * 8 - 1;
-              R &= RotateMask;
-              return (In >> R) | (In << (sizeof(In) * 8 - R));
-            };
-
-            switch (OpSize) {
-              case 1:
-                GD = Ror(static_cast<uint8_t>(Src1), static_cast<uint8_t>(Src2));
-                break;
-              case 2:
-                GD = Ror(static_cast<uint16_t>(Src1), static_cast<uint16_t>(Src2));
-                break;
-              case 4:
-                GD = Ror(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
-                break;
-              case 8: {
-                GD = Ror(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
-                break;
-              }
-              default: LogMan::Msg::A("Unknown ROR Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_ROL: {
-            auto Op = IROp->C<IR::IROp_Rol>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            auto Rol = [] (auto In, auto R) {
-            auto RotateMask = sizeof(In) * 8 - 1;
-              R &= RotateMask;
-              return (In << R) | (In >> (sizeof(In) * 8 - R));
-            };
-
-            switch (OpSize) {
-            case 1:
-              GD = Rol(static_cast<uint8_t>(Src1), static_cast<uint8_t>(Src2));
-              break;
-            case 2:
-              GD = Rol(static_cast<uint16_t>(Src1), static_cast<uint16_t>(Src2));
-              break;
-            case 4:
-              GD = Rol(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
-              break;
-            case 8: {
-              GD = Rol(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
-              break;
-            }
-            default: LogMan::Msg::A("Unknown ROL Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_NEG: {
-            auto Op = IROp->C<IR::IROp_Neg>();
-            uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            GD = ~Src;
-            break;
-          }
-          case IR::OP_ZEXT: {
-            auto Op = IROp->C<IR::IROp_Zext>();
-            LogMan::Throw::A(Op->SrcSize <= 64, "Can't support Zext of size: %ld", Op->SrcSize);
-            uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            if (Op->SrcSize == 64) {
-              // Zext 64bit to 128bit
-              __uint128_t SrcLarge = Src;
-              memcpy(GDP, &SrcLarge, 16);
-            }
-            else {
-              GD = Src & ((1ULL << Op->SrcSize) - 1);
-            }
-            break;
-          }
-          case IR::OP_SEXT: {
-            auto Op = IROp->C<IR::IROp_Sext>();
-            LogMan::Throw::A(Op->SrcSize <= 64, "Can't support Zext of size: %ld", Op->SrcSize);
-            switch (Op->SrcSize / 8) {
-              case 1:
-                GD = *GetSrc<int8_t*>(Op->Header.Args[0]);
-                break;
-              case 2:
-                GD = *GetSrc<int16_t*>(Op->Header.Args[0]);
-                break;
-              case 4:
-                GD = *GetSrc<int32_t*>(Op->Header.Args[0]);
-                break;
-              case 8:
-                GD = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                break;
-              default: LogMan::Msg::A("Unknown Sext size: %d", Op->SrcSize / 8);
-            }
-            break;
-          }
-          case IR::OP_MUL: {
-            auto Op = IROp->C<IR::IROp_Mul>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) * static_cast<int64_t>(static_cast<int8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) * static_cast<int64_t>(static_cast<int16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) * static_cast<int64_t>(Src2);
-                break;
-              case 16: {
-                __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_MULH: {
-            auto Op = IROp->C<IR::IROp_MulH>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1: {
-                int64_t Tmp = static_cast<int64_t>(static_cast<int8_t>(Src1)) * static_cast<int64_t>(static_cast<int8_t>(Src2));
-                GD = Tmp >> 8;
-                break;
-              }
-              case 2: {
-                int64_t Tmp = static_cast<int64_t>(static_cast<int16_t>(Src1)) * static_cast<int64_t>(static_cast<int16_t>(Src2));
-                GD = Tmp >> 16;
-                break;
-              }
-              case 4: {
-                int64_t Tmp = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
-                GD = Tmp >> 32;
-                break;
-              }
-              case 8: {
-                __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
-                GD = Tmp >> 64;
-              }
-              break;
-              default: LogMan::Msg::A("Unknown MulH Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UMUL: {
-            auto Op = IROp->C<IR::IROp_UMul>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint8_t>(Src1) * static_cast<uint8_t>(Src2);
-                break;
-              case 2:
-                GD = static_cast<uint16_t>(Src1) * static_cast<uint16_t>(Src2);
-                break;
-              case 4:
-                GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
-                break;
-              case 16: {
-                __uint128_t Tmp = static_cast<__uint128_t>(static_cast<uint64_t>(Src1)) * static_cast<__uint128_t>(static_cast<uint64_t>(Src2));
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown UMul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UMULH: {
-            auto Op = IROp->C<IR::IROp_UMulH>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint16_t>(Src1) * static_cast<uint16_t>(Src2);
-                GD >>= 8;
-                break;
-              case 2:
-                GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
-                GD >>= 16;
-                break;
-              case 4:
-                GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
-                GD >>= 32;
-                break;
-              case 8: {
-                __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
-                GD = Tmp >> 64;
-                break;
-              }
-              case 16: {
-                // XXX: This is incorrect
-                __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
-                GD = Tmp >> 64;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown UMulH Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_DIV: {
-            auto Op = IROp->C<IR::IROp_Div>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) / static_cast<int64_t>(static_cast<int8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) / static_cast<int64_t>(static_cast<int16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) / static_cast<int64_t>(static_cast<int32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) / static_cast<int64_t>(Src2);
-                break;
-              case 16: {
-                __int128_t Tmp = *GetSrc<__int128_t*>(Op->Header.Args[0]) / *GetSrc<__int128_t*>(Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UDIV: {
-            auto Op = IROp->C<IR::IROp_UDiv>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) / static_cast<uint64_t>(static_cast<uint8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) / static_cast<uint64_t>(static_cast<uint16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) / static_cast<uint64_t>(static_cast<uint32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) / static_cast<uint64_t>(Src2);
-                break;
-              case 16: {
-                __uint128_t Tmp = *GetSrc<__uint128_t*>(Op->Header.Args[0]) / *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_REM: {
-            auto Op = IROp->C<IR::IROp_Rem>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) % static_cast<int64_t>(static_cast<int8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) % static_cast<int64_t>(static_cast<int16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) % static_cast<int64_t>(static_cast<int32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) % static_cast<int64_t>(Src2);
-                break;
-              case 16: {
-                __int128_t Tmp = *GetSrc<__int128_t*>(Op->Header.Args[0]) % *GetSrc<__int128_t*>(Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UREM: {
-            auto Op = IROp->C<IR::IROp_URem>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) % static_cast<uint64_t>(static_cast<uint8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) % static_cast<uint64_t>(static_cast<uint16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) % static_cast<uint64_t>(static_cast<uint32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) % static_cast<uint64_t>(Src2);
-                break;
-              case 16: {
-                __uint128_t Tmp = *GetSrc<__uint128_t*>(Op->Header.Args[0]) % *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_POPCOUNT: {
-            auto Op = IROp->C<IR::IROp_Popcount>();
-            uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            GD = __builtin_popcountl(Src);
-            break;
-          }
-          case IR::OP_FINDLSB: {
-            auto Op = IROp->C<IR::IROp_FindLSB>();
-            uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Result = __builtin_ffsll(Src);
-            GD = Result - 1;
-            break;
-          }
-          case IR::OP_FINDMSB: {
-            auto Op = IROp->C<IR::IROp_FindMSB>();
-            switch (OpSize) {
-              case 1: GD = ((24 + OpSize * 8) - __builtin_clz(*GetSrc<uint8_t*>(Op->Header.Args[0]))) - 1; break;
-              case 2: GD = ((16 + OpSize * 8) - __builtin_clz(*GetSrc<uint16_t*>(Op->Header.Args[0]))) - 1; break;
-              case 4: GD = (OpSize * 8 - __builtin_clz(*GetSrc<uint32_t*>(Op->Header.Args[0]))) - 1; break;
-              case 8: GD = (OpSize * 8 - __builtin_clzll(*GetSrc<uint64_t*>(Op->Header.Args[0]))) - 1; break;
-              default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_REV: {
-            auto Op = IROp->C<IR::IROp_Rev>();
-            switch (OpSize) {
-              case 2: GD = __builtin_bswap16(*GetSrc<uint16_t*>(Op->Header.Args[0])); break;
-              case 4: GD = __builtin_bswap32(*GetSrc<uint32_t*>(Op->Header.Args[0])); break;
-              case 8: GD = __builtin_bswap64(*GetSrc<uint64_t*>(Op->Header.Args[0])); break;
-              default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_FINDTRAILINGZEROS: {
-            auto Op = IROp->C<IR::IROp_FindTrailingZeros>();
-            switch (OpSize) {
-              case 1: {
-                auto Src = *GetSrc<uint8_t*>(Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 2: {
-                auto Src = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 4: {
-                auto Src = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 8: {
-                auto Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctzll(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_BFI: {
-            auto Op = IROp->C<IR::IROp_Bfi>();
-            uint64_t SourceMask = (1ULL << Op->Width) - 1;
-            if (Op->Width == 64)
-              SourceMask = ~0ULL;
-            uint64_t DestMask = ~(SourceMask << Op->lsb);
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            uint64_t Res = (Src1 & DestMask) | ((Src2 & SourceMask) << Op->lsb);
-            GD = Res;
-            break;
-          }
-          case IR::OP_BFE: {
-            auto Op = IROp->C<IR::IROp_Bfe>();
-            LogMan::Throw::A(OpSize <= 16, "OpSize is too large for BFE: %d", OpSize);
-            if (OpSize == 16) {
-              LogMan::Throw::A(Op->Width <= 64, "Can't extract width of %d", Op->Width);
-              __uint128_t SourceMask = (1ULL << Op->Width) - 1;
-              if (Op->Width == 64)
-                SourceMask = ~0ULL;
-              SourceMask <<= Op->lsb;
-              __uint128_t Src = (*GetSrc<__uint128_t*>(Op->Header.Args[0]) & SourceMask) >> Op->lsb;
-              memcpy(GDP, &Src, OpSize);
-            }
-            else {
-              uint64_t SourceMask = (1ULL << Op->Width) - 1;
-              if (Op->Width == 64)
-                SourceMask = ~0ULL;
-              SourceMask <<= Op->lsb;
-              uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-              GD = (Src & SourceMask) >> Op->lsb;
-            }
-            break;
-          }
-          case IR::OP_SELECT: {
-            auto Op = IROp->C<IR::IROp_Select>();
-            bool CompResult = false;
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            uint64_t ArgTrue = *GetSrc<uint64_t*>(Op->Header.Args[2]);
-            uint64_t ArgFalse = *GetSrc<uint64_t*>(Op->Header.Args[3]);
-
-            switch (Op->Cond.Val) {
-              case FEXCore::IR::COND_EQ:
-                CompResult = Src1 == Src2;
-                break;
-              case FEXCore::IR::COND_NEQ:
-                CompResult = Src1 != Src2;
-                break;
-              case FEXCore::IR::COND_SGE:
-                CompResult = static_cast<int64_t>(Src1) >= static_cast<int64_t>(Src2);
-                break;
-              case FEXCore::IR::COND_SLT:
-                CompResult = static_cast<int64_t>(Src1) < static_cast<int64_t>(Src2);
-                break;
-              case FEXCore::IR::COND_SGT:
-                CompResult = static_cast<int64_t>(Src1) > static_cast<int64_t>(Src2);
-                break;
-              case FEXCore::IR::COND_SLE:
-                CompResult = static_cast<int64_t>(Src1) <= static_cast<int64_t>(Src2);
-                break;
-              case FEXCore::IR::COND_UGE:
-                CompResult = Src1 >= Src2;
-                break;
-              case FEXCore::IR::COND_ULT:
-                CompResult = Src1 < Src2;
-                break;
-              case FEXCore::IR::COND_UGT:
-                CompResult = Src1 > Src2;
-                break;
-              case FEXCore::IR::COND_ULE:
-                CompResult = Src1 <= Src2;
-                break;
-              case FEXCore::IR::COND_MI:
-              case FEXCore::IR::COND_PL:
-              case FEXCore::IR::COND_VS:
-              case FEXCore::IR::COND_VC:
-              default:
-                LogMan::Msg::A("Unsupported compare type");
-                break;
-            }
-            GD = CompResult ? ArgTrue : ArgFalse;
-            break;
-          }
-          case IR::OP_EXTRACTELEMENT: {
-            auto ExtractElementOp = IROp->C<IR::IROp_ExtractElement>();
-
-            uintptr_t DstPtr = GetDest<uintptr_t>(*WrapperOp);
-            uintptr_t SrcPtr = GetSrc<uintptr_t>(ExtractElementOp->Header.Args[0]);
-
-            // Offset to the element offset
-            SrcPtr += IROp->Size * ExtractElementOp->Idx;
-            memcpy(reinterpret_cast<void*>(DstPtr), reinterpret_cast<void*>(SrcPtr), IROp->Size);
-            break;
-          }
-          case IR::OP_CAS: {
-            auto Op = IROp->C<IR::IROp_CAS>();
-            auto Size = OpSize;
-            switch (Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                uint8_t Src1 = *GetSrc<uint8_t*>(Op->Header.Args[0]);
-                uint8_t Src2 = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-
-                uint8_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                uint16_t Src1 = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                uint16_t Src2 = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-
-                uint16_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                uint32_t Src1 = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t Src2 = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-
-                uint32_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-                uint64_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
-            }
-            break;
-          }
-          case IR::OP_ATOMICADD: {
-            auto Op = IROp->C<IR::IROp_AtomicAdd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Op->Header.Args[0]));
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICSUB: {
-            auto Op = IROp->C<IR::IROp_AtomicSub>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICAND: {
-            auto Op = IROp->C<IR::IROp_AtomicAnd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICOR: {
-            auto Op = IROp->C<IR::IROp_AtomicOr>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint8_t*>(Op->Header.Args[0]));
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Op->Header.Args[0]));
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICXOR: {
-            auto Op = IROp->C<IR::IROp_AtomicXor>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Op->Header.Args[0]));
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICSWAP: {
-            auto Op = IROp->C<IR::IROp_AtomicSwap>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHADD: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchAdd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHSUB: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchSub>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHAND: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchAnd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHOR: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchOr>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHXOR: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchXor>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          // Vector ops
-          case IR::OP_CREATEVECTOR2: {
-            auto Op = IROp->C<IR::IROp_CreateVector2>();
-            LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-            uint8_t ElementSize = OpSize / 2;
-            #define CREATE_VECTOR(elementsize, type) \
-              case elementsize: { \
-                auto *Dst_d = reinterpret_cast<type*>(Tmp); \
-                auto *Src1_d = reinterpret_cast<type*>(Src1); \
-                auto *Src2_d = reinterpret_cast<type*>(Src2); \
-                Dst_d[0] = *Src1_d; \
-                Dst_d[1] = *Src2_d; \
-                break; \
-              }
-            switch (ElementSize) {
-              CREATE_VECTOR(1, uint8_t)
-              CREATE_VECTOR(2, uint16_t)
-              CREATE_VECTOR(4, uint32_t)
-              CREATE_VECTOR(8, uint64_t)
-              default: LogMan::Msg::A("Unknown Element Size: %d", ElementSize); break;
-            }
-            #undef CREATE_VECTOR
-            memcpy(GDP, Tmp, OpSize);
-
-            break;
-          }
-          case IR::OP_SPLATVECTOR4:
-          case IR::OP_SPLATVECTOR3:
-          case IR::OP_SPLATVECTOR2: {
-            auto Op = IROp->C<IR::IROp_SplatVector2>();
-            LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-            uint8_t Elements = 0;
-
-            switch (Op->Header.Op) {
-              case IR::OP_SPLATVECTOR4: Elements = 4; break;
-              case IR::OP_SPLATVECTOR3: Elements = 3; break;
-              case IR::OP_SPLATVECTOR2: Elements = 2; break;
-              default: LogMan::Msg::A("Uknown Splat size"); break;
-            }
-
-            #define CREATE_VECTOR(elementsize, type) \
-              case elementsize: { \
-                auto *Dst_d = reinterpret_cast<type*>(Tmp); \
-                auto *Src_d = reinterpret_cast<type*>(Src); \
-                for (uint8_t i = 0; i < Elements; ++i) \
-                  Dst_d[i] = *Src_d;\
-                break; \
-              }
-            uint8_t ElementSize = OpSize / Elements;
-            switch (ElementSize) {
-              CREATE_VECTOR(1, uint8_t)
-              CREATE_VECTOR(2, uint16_t)
-              CREATE_VECTOR(4, uint32_t)
-              CREATE_VECTOR(8, uint64_t)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.Size); break;
-            }
-            #undef CREATE_VECTOR
-            memcpy(GDP, Tmp, OpSize);
-
-            break;
-          }
-          case IR::OP_VOR: {
-            auto Op = IROp->C<IR::IROp_VOr>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            __uint128_t Dst = Src1 | Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VAND: {
-            auto Op = IROp->C<IR::IROp_VAnd>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            __uint128_t Dst = Src1 & Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VXOR: {
-            auto Op = IROp->C<IR::IROp_VXor>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            __uint128_t Dst = Src1 ^ Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VSLI: {
-            auto Op = IROp->C<IR::IROp_VSLI>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = Op->ByteShift * 8;
-
-            __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 << Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VSRI: {
-            auto Op = IROp->C<IR::IROp_VSRI>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = Op->ByteShift * 8;
-
-            __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 >> Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VNOT: {
-            auto Op = IROp->C<IR::IROp_VNot>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-
-            __uint128_t Dst = ~Src1;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          #define DO_VECTOR_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_SCALAR_OP(size, type, func)\
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], *Src2_d);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_1SRC_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type*>(Src); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_SAT_OP(size, type, func, min, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], Src2_d[i], min, max);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          case IR::OP_VUSHRI: {
-            auto Op = IROp->C<IR::IROp_VUShrI>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(1, uint8_t, Func)
-              DO_VECTOR_1SRC_OP(2, uint16_t, Func)
-              DO_VECTOR_1SRC_OP(4, uint32_t, Func)
-              DO_VECTOR_1SRC_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSSHRI: {
-            auto Op = IROp->C<IR::IROp_VSShrI>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> BitShift; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(1, int8_t, Func)
-              DO_VECTOR_1SRC_OP(2, int16_t, Func)
-              DO_VECTOR_1SRC_OP(4, int32_t, Func)
-              DO_VECTOR_1SRC_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSHLI: {
-            auto Op = IROp->C<IR::IROp_VShlI>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : (a << BitShift); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(1, uint8_t, Func)
-              DO_VECTOR_1SRC_OP(2, uint16_t, Func)
-              DO_VECTOR_1SRC_OP(4, uint32_t, Func)
-              DO_VECTOR_1SRC_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-
-          case IR::OP_VADD: {
-            auto Op = IROp->C<IR::IROp_VAdd>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a + b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSUB: {
-            auto Op = IROp->C<IR::IROp_VSub>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a - b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUQADD: {
-            auto Op = IROp->C<IR::IROp_VUQAdd>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              decltype(a) res = a + b;
-              return res < a ? ~0U : res;
-            };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUQSUB: {
-            auto Op = IROp->C<IR::IROp_VUQSub>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              decltype(a) res = a - b;
-              return res > a ? 0U : res;
-            };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSQADD: {
-            auto Op = IROp->C<IR::IROp_VSQAdd>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              decltype(a) res = a + b;
-
-              if (a > 0) {
-                if (b > (std::numeric_limits<decltype(a)>::max() - a)) {
-                  return std::numeric_limits<decltype(a)>::max();
-                }
-              }
-              else if (b < (std::numeric_limits<decltype(a)>::min() - a)) {
-                return std::numeric_limits<decltype(a)>::min();
-              }
-
-              return res;
-            };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFADD: {
-            auto Op = IROp->C<IR::IROp_VFAdd>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a + b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFSUB: {
-            auto Op = IROp->C<IR::IROp_VFSub>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a - b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFMUL: {
-            auto Op = IROp->C<IR::IROp_VFMul>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFDIV: {
-            auto Op = IROp->C<IR::IROp_VFDiv>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a / b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFMIN: {
-            auto Op = IROp->C<IR::IROp_VFMin>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return std::min(a, b); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFMAX: {
-            auto Op = IROp->C<IR::IROp_VFMax>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return std::max(a, b); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFRECP: {
-            auto Op = IROp->C<IR::IROp_VFRecp>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a) { return 1.0 / a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFSQRT: {
-            auto Op = IROp->C<IR::IROp_VFSqrt>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a) { return std::sqrt(a); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFRSQRT: {
-            auto Op = IROp->C<IR::IROp_VFRSqrt>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a) { return 1.0 / std::sqrt(a); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          #define DO_VECTOR_1SRC_2TYPE_OP(size, type, type2, func, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type2*>(Src); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func(Src_d[i], max);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_1SRC_2TYPE_OP_TOP(size, type, type2, func, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type2*>(Src2); \
-            memcpy(Dst_d, Src1, Elements * sizeof(type2));\
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i+Elements] = (type)func(Src_d[i], max);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_2SRC_2TYPE_OP(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type2*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type2*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func((type)Src1_d[i], (type)Src2_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          case IR::OP_VSQXTUN: {
-            auto Op = IROp->C<IR::IROp_VSQXTUN>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))0); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(2, uint8_t, int16_t, Func, (1 << 8) - 1)
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint16_t, int32_t, Func, (1 << 16) - 1)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSQXTUN2: {
-            auto Op = IROp->C<IR::IROp_VSQXTUN2>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))0); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint8_t, int16_t, Func, (1 << 8) - 1)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(4, uint16_t, int32_t, Func, (1 << 16) - 1)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUCVTF: {
-            auto Op = IROp->C<IR::IROp_VUCVTF>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, float, uint32_t, Func, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, double, uint64_t, Func, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSCVTF: {
-            auto Op = IROp->C<IR::IROp_VSCVTF>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, float, int32_t, Func, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, double, int64_t, Func, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUMULL: {
-            auto Op = IROp->C<IR::IROp_VUMull>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP(1, uint16_t, uint8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(2, uint32_t, uint16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(4, uint64_t, uint32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSMULL: {
-            auto Op = IROp->C<IR::IROp_VSMull>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP(1, int16_t, int8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(2, int32_t, int16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(4, int64_t, int32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFCVTL: {
-            auto Op = IROp->C<IR::IROp_VFCVTL>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, double, float, Func, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFCVTN: {
-            auto Op = IROp->C<IR::IROp_VFCVTN>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(8, float, double, Func, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSXTL: {
-            auto Op = IROp->C<IR::IROp_VSXTL>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(1, int16_t, int8_t, Func,  0)
-              DO_VECTOR_1SRC_2TYPE_OP(2, int32_t, int16_t, Func, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(4, int64_t, int32_t, Func, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUXTL: {
-            auto Op = IROp->C<IR::IROp_VUXTL>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(1, uint16_t, uint8_t, Func,  0)
-              DO_VECTOR_1SRC_2TYPE_OP(2, uint32_t, uint16_t, Func, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint64_t, uint32_t, Func, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUMIN: {
-            auto Op = IROp->C<IR::IROp_VUMin>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return std::min(a, b); };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSMIN: {
-            auto Op = IROp->C<IR::IROp_VSMin>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return std::min(a, b); };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUMAX: {
-            auto Op = IROp->C<IR::IROp_VUMax>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return std::max(a, b); };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSMAX: {
-            auto Op = IROp->C<IR::IROp_VSMax>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return std::max(a, b); };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUSHL: {
-            auto Op = IROp->C<IR::IROp_VUShl>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSSHR: {
-            auto Op = IROp->C<IR::IROp_VSShr>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-
-          case IR::OP_VUSHLS: {
-            auto Op = IROp->C<IR::IROp_VUShlS>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
-              DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
-              DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
-              DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
-              DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUSHRS: {
-            auto Op = IROp->C<IR::IROp_VUShrS>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
-              DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
-              DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
-              DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
-              DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSSHRS: {
-            auto Op = IROp->C<IR::IROp_VSShrS>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_SCALAR_OP(1, int8_t, Func)
-              DO_VECTOR_SCALAR_OP(2, int16_t, Func)
-              DO_VECTOR_SCALAR_OP(4, int32_t, Func)
-              DO_VECTOR_SCALAR_OP(8, int64_t, Func)
-              DO_VECTOR_SCALAR_OP(16, __int128_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUSHR: {
-            auto Op = IROp->C<IR::IROp_VUShr>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return a >> b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VZIP2:
-          case IR::OP_VZIP: {
-            auto Op = IROp->C<IR::IROp_VZip>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            uint8_t BaseOffset = IROp->Op == IR::OP_VZIP2 ? (Elements / 2) : 0;
-            Elements >>= 1;
-
-            switch (Op->ElementSize) {
-              case 1: {
-                auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint8_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              case 2: {
-                auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint16_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              case 4: {
-                auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint32_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              case 8: {
-                auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint64_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VINSELEMENT: {
-            auto Op = IROp->C<IR::IROp_VInsElement>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            // Copy src1 in to dest
-            memcpy(Tmp, Src1, Op->RegisterSize);
-            switch (Op->ElementSize) {
-              case 1: {
-                auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              case 2: {
-                auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              case 4: {
-                auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              case 8: {
-                auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            };
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VCMPEQ: {
-            auto Op = IROp->C<IR::IROp_VCMPEQ>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,   Func)
-              DO_VECTOR_OP(2, uint16_t,  Func)
-              DO_VECTOR_OP(4, uint32_t,  Func)
-              DO_VECTOR_OP(8, uint64_t,  Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VCMPGT: {
-            auto Op = IROp->C<IR::IROp_VCMPGT>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return a > b ? ~0ULL : 0; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,   Func)
-              DO_VECTOR_OP(2, int16_t,  Func)
-              DO_VECTOR_OP(4, int32_t,  Func)
-              DO_VECTOR_OP(8, int64_t,  Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_LUDIV: {
-            auto Op = IROp->C<IR::IROp_LUDiv>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit divide from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Divisor = *GetSrc<uint16_t*>(Op->Header.Args[2]);
-                uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                uint32_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint16_t>(Res);
-                break;
-              }
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
-                uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                uint64_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Divisor = *GetSrc<uint64_t*>(Op->Header.Args[2]);
-                __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
-                __uint128_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LUDIV Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LDIV: {
-            auto Op = IROp->C<IR::IROp_LDiv>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit divide from x86-64
-            switch (OpSize) {
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                int32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
-                int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                int64_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                int64_t Divisor = *GetSrc<int64_t*>(Op->Header.Args[2]);
-                __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
-                __int128_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LDIV Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LUREM: {
-            auto Op = IROp->C<IR::IROp_LURem>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit Remainder from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Divisor = *GetSrc<uint16_t*>(Op->Header.Args[2]);
-                uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                uint32_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint16_t>(Res);
-                break;
-              }
-
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
-                uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                uint64_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Divisor = *GetSrc<uint64_t*>(Op->Header.Args[2]);
-                __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
-                __uint128_t Res = Source % Divisor;
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LUREM Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LREM: {
-            auto Op = IROp->C<IR::IROp_LRem>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit Remainder from x86-64
-            switch (OpSize) {
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                int32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
-                int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                int64_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                int64_t Divisor = *GetSrc<int64_t*>(Op->Header.Args[2]);
-                __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
-                __int128_t Res = Source % Divisor;
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LREM Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_VEXTR: {
-            auto Op = IROp->C<IR::IROp_VExtr>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            uint64_t Offset = Op->Index * Op->ElementSize * 8;
-            __uint128_t Dst = (Src1 << (sizeof(__uint128_t) * 8 - Offset)) | (Src2 >> Offset);
-
-            memcpy(GDP, &Dst, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VINSGPR: {
-            auto Op = IROp->C<IR::IROp_VInsGPR>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            uint64_t Offset = Op->Index * Op->ElementSize * 8;
-            __uint128_t Mask = (1ULL << (Op->ElementSize * 8)) - 1;
-            Mask <<= Offset;
-            Mask = ~Mask;
-            __uint128_t Dst = Src1 & Mask;
-            Dst |= Src2 << Offset;
-
-            memcpy(GDP, &Dst, Op->RegisterSize);
-            break;
-          }
-
-          case IR::OP_SCVTF: {
-            auto Op = IROp->C<IR::IROp_SCVTF>();
-            if (Op->ElementSize == 8) {
-              double Dst = (double)*GetSrc<int64_t*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            else {
-              float Dst = (float)*GetSrc<int32_t*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FCVTZS: {
-            auto Op = IROp->C<IR::IROp_SCVTF>();
-            if (Op->ElementSize == 8) {
-              int64_t Dst = (int64_t)*GetSrc<double*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            else {
-              int32_t Dst = (int32_t)*GetSrc<float*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FCVTF: {
-            auto Op = IROp->C<IR::IROp_FCVTF>();
-            uint16_t Conv = (Op->DstElementSize << 8) | Op->SrcElementSize;
-            switch (Conv) {
-              case 0x0804: { // Double <- Float
-                double Dst = (double)*GetSrc<float*>(Op->Header.Args[0]);
-                memcpy(GDP, &Dst, 8);
-                break;
-              }
-              case 0x0408: { // Float <- Double
-                float Dst = (float)*GetSrc<double*>(Op->Header.Args[0]);
-                memcpy(GDP, &Dst, 4);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown FCVT sizes: 0x%x", Conv);
-            }
-            break;
-          }
-          #define DO_SCALAR_COMPARE_OP(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            Dst_d[0] = func(Src1_d[0], Src2_d[0]);          \
-            break;                                            \
-            }
-
-          #define DO_VECTOR_COMPARE_OP(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          case IR::OP_VFCMPEQ: {
-            auto Op = IROp->C<IR::IROp_VFCMPEQ>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFCMPNEQ: {
-            auto Op = IROp->C<IR::IROp_VFCMPNEQ>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a != b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFCMPLT: {
-            auto Op = IROp->C<IR::IROp_VFCMPLT>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a < b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-
-          case IR::OP_VFCMPLE: {
-            auto Op = IROp->C<IR::IROp_VFCMPLE>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a <= b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-
-          default:
-            LogMan::Msg::A("Unknown IR Op: %d(%s)", IROp->Op, FEXCore::IR::GetName(IROp->Op).data());
-            break;
-        }
-
-        // CodeLast is inclusive. So we still need to dump the CodeLast op as well
-        if (CodeBegin == CodeLast) {
-          break;
-        }
-        ++CodeBegin;
+    auto CodeBegin = IR->at(BlockIROp->Begin);
+    auto CodeLast = IR->at(BlockIROp->Last);
+
+    while (1) {
+      OrderedNodeWrapper *WrapperOp = CodeBegin();
+      FEXCore::IR::IROp_Header *IROp = WrapperOp->GetNode(ListBegin)->Op(DataBegin);
+
+      InterpreterOp Op{};
+      Op.IROp = IROp;
+
+      if (IROp->HasDest) {
+        // XXX: IR generation has a bug where the size can periodically end up being zero
+        size_t Size = IROp->Size * std::max(static_cast<uint8_t>(1), IROp->Elements);
+        Size = Size < 16 ? 16 : Size;
+
+        // Force alignment by size
+        size_t NewBase = AlignUp(TmpOffset, Size);
+        TmpOffset = NewBase + Size;
+
+        Program->Slots[WrapperOp->ID()] = NewBase;
+        Op.Dest = NewBase;
+      }
+
+      // Jump targets are block IDs until every block has been placed
+      if (IROp->Op == IR::OP_CONDJUMP) {
+        Op.Targets[0] = IROp->Args[1].ID();
+        Op.Targets[1] = IROp->Args[2].ID();
+      }
+      else if (IROp->Op == IR::OP_JUMP) {
+        Op.Targets[0] = IROp->Args[0].ID();
       }
-    };
 
-    HandleBlock();
+      Program->Ops.emplace_back(Op);
 
-    if (BlockResults.Redo) {
-      continue;
+      // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
     }
 
-    if (BlockIROp->Next.ID() == 0 || BlockResults.Quit) {
+    if (BlockIROp->Next.ID() == 0) {
       break;
     } else {
-      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      BlockWrapper = BlockIROp->Next;
+    }
+  }
+
+  // Running off the end of the last block leaves the program
+  InterpreterOp Exit{};
+  Exit.IROp = HeaderNode->Op(DataBegin);
+  Program->Ops.emplace_back(Exit);
+
+  for (auto &Op : Program->Ops) {
+    if (Op.IROp->Op == IR::OP_CONDJUMP) {
+      Op.Targets[0] = BlockStart[Op.Targets[0]];
+      Op.Targets[1] = BlockStart[Op.Targets[1]];
+    }
+    else if (Op.IROp->Op == IR::OP_JUMP) {
+      Op.Targets[0] = BlockStart[Op.Targets[0]];
+    }
+  }
+
+  // Dispatch always clears 16 bytes of the destination
+  Program->TmpSize = TmpOffset + 16;
+
+  auto Result = Program.get();
+  std::shared_ptr<InterpreterProgram> SharedProgram = std::move(Program);
+  Programs[HeaderOp->Entry] = SharedProgram;
+  ProgramsByEntry[HeaderOp->Entry] = SharedProgram;
+  return Result;
+}
+
+void InterpreterCore::InvalidateGuestCodeRange(uint64_t Address, uint64_t Size) {
+  for (auto it = Programs.begin(); it != Programs.end();) {
+    if (it->first >= Address && it->first < (Address + Size)) {
+      it = Programs.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+
+  for (auto it = ProgramsByEntry.begin(); it != ProgramsByEntry.end();) {
+    if (it->first >= Address && it->first < (Address + Size)) {
+      it = ProgramsByEntry.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+void *InterpreterCore::CompileCode(FEXCore::IR::IRListView<true> const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData) {
+  // Translate ahead of time so the first execution doesn't have to
+  // This also replaces any stale program if the block was recompiled
+  if (IR) {
+    TranslateIR(IR);
+  }
+  return reinterpret_cast<void*>(InterpreterExecution);
+}
+
+void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
+  using namespace FEXCore::IR;
+
+  auto DebugData = Thread->DebugData.find(Thread->State.State.rip);
+
+  InterpreterProgram *Program{};
+  auto ProgramIt = Programs.find(Thread->State.State.rip);
+  if (ProgramIt != Programs.end()) {
+    Program = ProgramIt->second.get();
+  }
+  else {
+    auto IR = Thread->IRLists.find(Thread->State.State.rip);
+    uint64_t Entry = GetIREntry(IR->second.get());
+    auto SharedProgram = ProgramsByEntry.find(Entry);
+    if (SharedProgram != ProgramsByEntry.end()) {
+      Program = SharedProgram->second.get();
+    }
+    else {
+      Program = TranslateIR(IR->second.get());
+    }
+    Programs[Thread->State.State.rip] = ProgramsByEntry[Entry];
+  }
+
+  if (!DispatchTableInitialized) {
+    DispatchTable.fill(&&Handler_Unhandled);
+    DispatchTable[IR::OP_IRHEADER] = &&Handler_Exit;
+    DispatchTable[IR::OP_DUMMY] = &&Handler_OP_DUMMY;
+    DispatchTable[IR::OP_BEGINBLOCK] = &&Handler_OP_BEGINBLOCK;
+    DispatchTable[IR::OP_ENDBLOCK] = &&Handler_OP_ENDBLOCK;
+    DispatchTable[IR::OP_EXITFUNCTION] = &&Handler_OP_EXITFUNCTION;
+    DispatchTable[IR::OP_CONDJUMP] = &&Handler_OP_CONDJUMP;
+    DispatchTable[IR::OP_JUMP] = &&Handler_OP_JUMP;
+    DispatchTable[IR::OP_BREAK] = &&Handler_OP_BREAK;
+    DispatchTable[IR::OP_SYSCALL] = &&Handler_OP_SYSCALL;
+    DispatchTable[IR::OP_SYSCALLDIRECT] = &&Handler_OP_SYSCALLDIRECT;
+    DispatchTable[IR::OP_CPUID] = &&Handler_OP_CPUID;
+    DispatchTable[IR::OP_PRINT] = &&Handler_OP_PRINT;
+    DispatchTable[IR::OP_CYCLECOUNTER] = &&Handler_OP_CYCLECOUNTER;
+    DispatchTable[IR::OP_MOV] = &&Handler_OP_MOV;
+    DispatchTable[IR::OP_VBITCAST] = &&Handler_OP_VBITCAST;
+    DispatchTable[IR::OP_VCASTFROMGPR] = &&Handler_OP_VCASTFROMGPR;
+    DispatchTable[IR::OP_VEXTRACTTOGPR] = &&Handler_OP_VEXTRACTTOGPR;
+    DispatchTable[IR::OP_CONSTANT] = &&Handler_OP_CONSTANT;
+    DispatchTable[IR::OP_LOADCONTEXT] = &&Handler_OP_LOADCONTEXT;
+    DispatchTable[IR::OP_LOADCONTEXTINDEXED] = &&Handler_OP_LOADCONTEXTINDEXED;
+    DispatchTable[IR::OP_STORECONTEXT] = &&Handler_OP_STORECONTEXT;
+    DispatchTable[IR::OP_STORECONTEXTINDEXED] = &&Handler_OP_STORECONTEXTINDEXED;
+    DispatchTable[IR::OP_LOADFLAG] = &&Handler_OP_LOADFLAG;
+    DispatchTable[IR::OP_STOREFLAG] = &&Handler_OP_STOREFLAG;
+    DispatchTable[IR::OP_LOADMEM] = &&Handler_OP_LOADMEM;
+    DispatchTable[IR::OP_STOREMEM] = &&Handler_OP_STOREMEM;
+    DispatchTable[IR::OP_MEMSET] = &&Handler_OP_MEMSET;
+    DispatchTable[IR::OP_MEMCPY] = &&Handler_OP_MEMCPY;
+    DispatchTable[IR::OP_MEMCMP] = &&Handler_OP_MEMCMP;
+    DispatchTable[IR::OP_MEMSCAN] = &&Handler_OP_MEMSCAN;
+    DispatchTable[IR::OP_ADD] = &&Handler_OP_ADD;
+    DispatchTable[IR::OP_SUB] = &&Handler_OP_SUB;
+    DispatchTable[IR::OP_OR] = &&Handler_OP_OR;
+    DispatchTable[IR::OP_AND] = &&Handler_OP_AND;
+    DispatchTable[IR::OP_XOR] = &&Handler_OP_XOR;
+    DispatchTable[IR::OP_LSHL] = &&Handler_OP_LSHL;
+    DispatchTable[IR::OP_LSHR] = &&Handler_OP_LSHR;
+    DispatchTable[IR::OP_ASHR] = &&Handler_OP_ASHR;
+    DispatchTable[IR::OP_ROR] = &&Handler_OP_ROR;
+    DispatchTable[IR::OP_ROL] = &&Handler_OP_ROL;
+    DispatchTable[IR::OP_NEG] = &&Handler_OP_NEG;
+    DispatchTable[IR::OP_ZEXT] = &&Handler_OP_ZEXT;
+    DispatchTable[IR::OP_SEXT] = &&Handler_OP_SEXT;
+    DispatchTable[IR::OP_MUL] = &&Handler_OP_MUL;
+    DispatchTable[IR::OP_MULH] = &&Handler_OP_MULH;
+    DispatchTable[IR::OP_UMUL] = &&Handler_OP_UMUL;
+    DispatchTable[IR::OP_UMULH] = &&Handler_OP_UMULH;
+    DispatchTable[IR::OP_DIV] = &&Handler_OP_DIV;
+    DispatchTable[IR::OP_UDIV] = &&Handler_OP_UDIV;
+    DispatchTable[IR::OP_REM] = &&Handler_OP_REM;
+    DispatchTable[IR::OP_UREM] = &&Handler_OP_UREM;
+    DispatchTable[IR::OP_POPCOUNT] = &&Handler_OP_POPCOUNT;
+    DispatchTable[IR::OP_FINDLSB] = &&Handler_OP_FINDLSB;
+    DispatchTable[IR::OP_FINDMSB] = &&Handler_OP_FINDMSB;
+    DispatchTable[IR::OP_REV] = &&Handler_OP_REV;
+    DispatchTable[IR::OP_FINDTRAILINGZEROS] = &&Handler_OP_FINDTRAILINGZEROS;
+    DispatchTable[IR::OP_BFI] = &&Handler_OP_BFI;
+    DispatchTable[IR::OP_BFE] = &&Handler_OP_BFE;
+    DispatchTable[IR::OP_SELECT] = &&Handler_OP_SELECT;
+    DispatchTable[IR::OP_EXTRACTELEMENT] = &&Handler_OP_EXTRACTELEMENT;
+    DispatchTable[IR::OP_CAS] = &&Handler_OP_CAS;
+    DispatchTable[IR::OP_ATOMICADD] = &&Handler_OP_ATOMICADD;
+    DispatchTable[IR::OP_ATOMICSUB] = &&Handler_OP_ATOMICSUB;
+    DispatchTable[IR::OP_ATOMICAND] = &&Handler_OP_ATOMICAND;
+    DispatchTable[IR::OP_ATOMICOR] = &&Handler_OP_ATOMICOR;
+    DispatchTable[IR::OP_ATOMICXOR] = &&Handler_OP_ATOMICXOR;
+    DispatchTable[IR::OP_ATOMICSWAP] = &&Handler_OP_ATOMICSWAP;
+    DispatchTable[IR::OP_ATOMICFETCHADD] = &&Handler_OP_ATOMICFETCHADD;
+    DispatchTable[IR::OP_ATOMICFETCHSUB] = &&Handler_OP_ATOMICFETCHSUB;
+    DispatchTable[IR::OP_ATOMICFETCHAND] = &&Handler_OP_ATOMICFETCHAND;
+    DispatchTable[IR::OP_ATOMICFETCHOR] = &&Handler_OP_ATOMICFETCHOR;
+    DispatchTable[IR::OP_ATOMICFETCHXOR] = &&Handler_OP_ATOMICFETCHXOR;
+    DispatchTable[IR::OP_CREATEVECTOR2] = &&Handler_OP_CREATEVECTOR2;
+    DispatchTable[IR::OP_SPLATVECTOR4] = &&Handler_OP_SPLATVECTOR4;
+    DispatchTable[IR::OP_SPLATVECTOR3] = &&Handler_OP_SPLATVECTOR3;
+    DispatchTable[IR::OP_SPLATVECTOR2] = &&Handler_OP_SPLATVECTOR2;
+    DispatchTable[IR::OP_VOR] = &&Handler_OP_VOR;
+    DispatchTable[IR::OP_VAND] = &&Handler_OP_VAND;
+    DispatchTable[IR::OP_VXOR] = &&Handler_OP_VXOR;
+    DispatchTable[IR::OP_VSLI] = &&Handler_OP_VSLI;
+    DispatchTable[IR::OP_VSRI] = &&Handler_OP_VSRI;
+    DispatchTable[IR::OP_VNOT] = &&Handler_OP_VNOT;
+    DispatchTable[IR::OP_VUSHRI] = &&Handler_OP_VUSHRI;
+    DispatchTable[IR::OP_VSSHRI] = &&Handler_OP_VSSHRI;
+    DispatchTable[IR::OP_VSHLI] = &&Handler_OP_VSHLI;
+    DispatchTable[IR::OP_VADD] = &&Handler_OP_VADD;
+    DispatchTable[IR::OP_VSUB] = &&Handler_OP_VSUB;
+    DispatchTable[IR::OP_VUQADD] = &&Handler_OP_VUQADD;
+    DispatchTable[IR::OP_VUQSUB] = &&Handler_OP_VUQSUB;
+    DispatchTable[IR::OP_VSQADD] = &&Handler_OP_VSQADD;
+    DispatchTable[IR::OP_VFADD] = &&Handler_OP_VFADD;
+    DispatchTable[IR::OP_VFSUB] = &&Handler_OP_VFSUB;
+    DispatchTable[IR::OP_VFMUL] = &&Handler_OP_VFMUL;
+    DispatchTable[IR::OP_VFDIV] = &&Handler_OP_VFDIV;
+    DispatchTable[IR::OP_VFMIN] = &&Handler_OP_VFMIN;
+    DispatchTable[IR::OP_VFMAX] = &&Handler_OP_VFMAX;
+    DispatchTable[IR::OP_VFRECP] = &&Handler_OP_VFRECP;
+    DispatchTable[IR::OP_VFSQRT] = &&Handler_OP_VFSQRT;
+    DispatchTable[IR::OP_VFRSQRT] = &&Handler_OP_VFRSQRT;
+    DispatchTable[IR::OP_VSQXTUN] = &&Handler_OP_VSQXTUN;
+    DispatchTable[IR::OP_VSQXTUN2] = &&Handler_OP_VSQXTUN2;
+    DispatchTable[IR::OP_VUCVTF] = &&Handler_OP_VUCVTF;
+    DispatchTable[IR::OP_VSCVTF] = &&Handler_OP_VSCVTF;
+    DispatchTable[IR::OP_VUMULL] = &&Handler_OP_VUMULL;
+    DispatchTable[IR::OP_VSMULL] = &&Handler_OP_VSMULL;
+    DispatchTable[IR::OP_VFCVTL] = &&Handler_OP_VFCVTL;
+    DispatchTable[IR::OP_VFCVTN] = &&Handler_OP_VFCVTN;
+    DispatchTable[IR::OP_VSXTL] = &&Handler_OP_VSXTL;
+    DispatchTable[IR::OP_VUXTL] = &&Handler_OP_VUXTL;
+    DispatchTable[IR::OP_VUMIN] = &&Handler_OP_VUMIN;
+    DispatchTable[IR::OP_VSMIN] = &&Handler_OP_VSMIN;
+    DispatchTable[IR::OP_VUMAX] = &&Handler_OP_VUMAX;
+    DispatchTable[IR::OP_VSMAX] = &&Handler_OP_VSMAX;
+    DispatchTable[IR::OP_VUSHL] = &&Handler_OP_VUSHL;
+    DispatchTable[IR::OP_VSSHR] = &&Handler_OP_VSSHR;
+    DispatchTable[IR::OP_VUSHLS] = &&Handler_OP_VUSHLS;
+    DispatchTable[IR::OP_VUSHRS] = &&Handler_OP_VUSHRS;
+    DispatchTable[IR::OP_VSSHRS] = &&Handler_OP_VSSHRS;
+    DispatchTable[IR::OP_VUSHR] = &&Handler_OP_VUSHR;
+    DispatchTable[IR::OP_VZIP2] = &&Handler_OP_VZIP2;
+    DispatchTable[IR::OP_VZIP] = &&Handler_OP_VZIP;
+    DispatchTable[IR::OP_VINSELEMENT] = &&Handler_OP_VINSELEMENT;
+    DispatchTable[IR::OP_VCMPEQ] = &&Handler_OP_VCMPEQ;
+    DispatchTable[IR::OP_VCMPGT] = &&Handler_OP_VCMPGT;
+    DispatchTable[IR::OP_LUDIV] = &&Handler_OP_LUDIV;
+    DispatchTable[IR::OP_LDIV] = &&Handler_OP_LDIV;
+    DispatchTable[IR::OP_LUREM] = &&Handler_OP_LUREM;
+    DispatchTable[IR::OP_LREM] = &&Handler_OP_LREM;
+    DispatchTable[IR::OP_VEXTR] = &&Handler_OP_VEXTR;
+    DispatchTable[IR::OP_VINSGPR] = &&Handler_OP_VINSGPR;
+    DispatchTable[IR::OP_SCVTF] = &&Handler_OP_SCVTF;
+    DispatchTable[IR::OP_FCVTZS] = &&Handler_OP_FCVTZS;
+    DispatchTable[IR::OP_FCVTF] = &&Handler_OP_FCVTF;
+    DispatchTable[IR::OP_VFCMPEQ] = &&Handler_OP_VFCMPEQ;
+    DispatchTable[IR::OP_VFCMPNEQ] = &&Handler_OP_VFCMPNEQ;
+    DispatchTable[IR::OP_VFCMPLT] = &&Handler_OP_VFCMPLT;
+    DispatchTable[IR::OP_VFCMPLE] = &&Handler_OP_VFCMPLE;
+    DispatchTableInitialized = true;
+  }
+
+  if (!Program->HandlersResolved) {
+    for (auto &Op : Program->Ops) {
+      Op.Handler = DispatchTable[Op.IROp->Op];
     }
+    Program->HandlersResolved = true;
   }
 
+  if (Program->TmpSize > TmpSpace.size()) {
+    TmpSpace.resize(std::max(TmpSpace.size() * 2, Program->TmpSize));
+  }
+
+  uint8_t *TmpBase = TmpSpace.data();
+  CurrentSlots = Program->Slots.data();
+
+  InterpreterOp const *Inst = Program->Ops.data();
+  FEXCore::IR::IROp_Header *IROp;
+  uint8_t OpSize;
+
+#define GD *reinterpret_cast<uint64_t*>(&TmpBase[Inst->Dest])
+#define GDP reinterpret_cast<void*>(&TmpBase[Inst->Dest])
+
+  // Clear any previous results before entering the op's handler
+#define DISPATCH() \
+  IROp = Inst->IROp; \
+  OpSize = IROp->Size; \
+  memset(GDP, 0, 16); \
+  goto *Inst->Handler
+#define NEXT() \
+  ++Inst; \
+  DISPATCH()
+
+  DISPATCH();
+
+  Handler_OP_DUMMY:
+  Handler_OP_BEGINBLOCK: {
+    NEXT();
+  }
+  Handler_OP_ENDBLOCK: {
+    auto Op = IROp->C<IR::IROp_EndBlock>();
+    Thread->State.State.rip += Op->RIPIncrement;
+    NEXT();
+  }
+  Handler_OP_EXITFUNCTION: {
+    goto Handler_Exit;
+  }
+  Handler_OP_CONDJUMP: {
+    auto Op = IROp->C<IR::IROp_CondJump>();
+    uint64_t Arg = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    Inst = &Program->Ops[Inst->Targets[!!Arg ? 0 : 1]];
+    DISPATCH();
+  }
+  Handler_OP_JUMP: {
+    Inst = &Program->Ops[Inst->Targets[0]];
+    DISPATCH();
+  }
+  Handler_OP_BREAK: do {
+    auto Op = IROp->C<IR::IROp_Break>();
+    switch (Op->Reason) {
+      case 4: // HLT
+        Thread->State.RunningEvents.ShouldStop = true;
+        goto Handler_Exit;
+      break;
+    default: LogMan::Msg::A("Unknown Break Reason: %d", Op->Reason); break;
+    }
+  } while (0);
+  NEXT();
+  Handler_OP_SYSCALL: do {
+    auto Op = IROp->C<IR::IROp_Syscall>();
+
+    FEXCore::HLE::SyscallArguments Args;
+    for (size_t j = 0; j < 7; ++j)
+      Args.Argument[j] = *GetSrc<uint64_t*>(Op->Header.Args[j]);
+
+    uint64_t Res = CTX->SyscallHandler.HandleSyscall(Thread, &Args);
+    GD = Res;
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_SYSCALLDIRECT: do {
+    auto Op = IROp->C<IR::IROp_SyscallDirect>();
+
+    FEXCore::HLE::SyscallArguments Args;
+    for (size_t j = 0; j < 7; ++j)
+      Args.Argument[j] = *GetSrc<uint64_t*>(Op->Header.Args[j]);
+
+    auto Handler = FEXCore::SyscallHandler::GetDirectHandler(Op->Syscall);
+    uint64_t Res = Handler(&CTX->SyscallHandler, Thread, &Args);
+    GD = Res;
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_CPUID: do {
+    auto Op = IROp->C<IR::IROp_CPUID>();
+    uint64_t *DstPtr = reinterpret_cast<uint64_t*>(GDP);
+    uint64_t Arg = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+
+    auto Results = CTX->CPUID.RunFunction(Arg);
+    memcpy(DstPtr, &Results.Res, sizeof(uint32_t) * 4);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_PRINT: do {
+    auto Op = IROp->C<IR::IROp_Print>();
+
+    if (OpSize <= 8) {
+      uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+      LogMan::Msg::I(">>>> Value in Arg: 0x%lx, %ld", Src, Src);
+    }
+    else if (OpSize == 16) {
+      __uint128_t Src = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+      uint64_t Src0 = Src;
+      uint64_t Src1 = Src >> 64;
+      LogMan::Msg::I(">>>> Value[0] in Arg: 0x%lx, %ld", Src0, Src0);
+      LogMan::Msg::I("     Value[1] in Arg: 0x%lx, %ld", Src1, Src1);
+    }
+    else
+      LogMan::Msg::A("Unknown value size: %d", OpSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_CYCLECOUNTER: do {
+    #ifdef DEBUG_CYCLES
+      GD = 0;
+    #else
+      timespec time;
+      clock_gettime(CLOCK_REALTIME, &time);
+      GD = time.tv_nsec + time.tv_sec * 1000000000;
+    #endif
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_MOV: do {
+    auto Op = IROp->C<IR::IROp_Mov>();
+    memcpy(GDP, GetSrc<void*>(Op->Header.Args[0]), OpSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VBITCAST: do {
+    auto Op = IROp->C<IR::IROp_VBitcast>();
+    memcpy(GDP, GetSrc<void*>(Op->Header.Args[0]), 16);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VCASTFROMGPR: do {
+    auto Op = IROp->C<IR::IROp_VCastFromGPR>();
+    memcpy(GDP, GetSrc<void*>(Op->Header.Args[0]), Op->ElementSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VEXTRACTTOGPR: do {
+    auto Op = IROp->C<IR::IROp_VExtractToGPR>();
+    LogMan::Throw::A(Op->RegisterSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
+    if (Op->RegisterSize == 16) {
+      __uint128_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
+      uint64_t Shift = Op->ElementSize * Op->Idx * 8;
+      if (Op->ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      __uint128_t Src = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      memcpy(GDP, &Src, Op->ElementSize);
+    }
+    else {
+      uint64_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
+      uint64_t Shift = Op->ElementSize * Op->Idx * 8;
+      if (Op->ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      GD = Src;
+    }
+    break;
+  } while (0);
+  NEXT();
+
+  Handler_OP_CONSTANT: do {
+    auto Op = IROp->C<IR::IROp_Constant>();
+    GD = Op->Constant;
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LOADCONTEXT: do {
+    auto Op = IROp->C<IR::IROp_LoadContext>();
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->Offset;
+    #define LOAD_CTX(x, y) \
+      case x: { \
+        y const *Data = reinterpret_cast<y const*>(ContextPtr); \
+        GD = *Data; \
+        break; \
+      }
+    switch (Op->Size) {
+      LOAD_CTX(1, uint8_t)
+      LOAD_CTX(2, uint16_t)
+      LOAD_CTX(4, uint32_t)
+      LOAD_CTX(8, uint64_t)
+      case 16: {
+        void const *Data = reinterpret_cast<void const*>(ContextPtr);
+        memcpy(GDP, Data, Op->Size);
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled LoadContext size: %d", Op->Size);
+    }
+    #undef LOAD_CTX
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LOADCONTEXTINDEXED: do {
+    auto Op = IROp->C<IR::IROp_LoadContextIndexed>();
+    uint64_t Index = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->BaseOffset;
+    ContextPtr += Index * Op->Stride;
+
+    #define LOAD_CTX(x, y) \
+      case x: { \
+        y const *Data = reinterpret_cast<y const*>(ContextPtr); \
+        GD = *Data; \
+        break; \
+      }
+    switch (Op->Size) {
+      LOAD_CTX(1, uint8_t)
+      LOAD_CTX(2, uint16_t)
+      LOAD_CTX(4, uint32_t)
+      LOAD_CTX(8, uint64_t)
+      case 16: {
+        void const *Data = reinterpret_cast<void const*>(ContextPtr);
+        memcpy(GDP, Data, Op->Size);
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled LoadContextIndexed size: %d", Op->Size);
+    }
+    #undef LOAD_CTX
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_STORECONTEXT: do {
+    auto Op = IROp->C<IR::IROp_StoreContext>();
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->Offset;
+
+    void *Data = reinterpret_cast<void*>(ContextPtr);
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    memcpy(Data, Src, Op->Size);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_STORECONTEXTINDEXED: do {
+    auto Op = IROp->C<IR::IROp_StoreContextIndexed>();
+    uint64_t Index = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->BaseOffset;
+    ContextPtr += Index * Op->Stride;
+
+    void *Data = reinterpret_cast<void*>(ContextPtr);
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    memcpy(Data, Src, Op->Size);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LOADFLAG: do {
+    auto Op = IROp->C<IR::IROp_LoadFlag>();
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
+    ContextPtr += Op->Flag;
+    uint8_t const *Data = reinterpret_cast<uint8_t const*>(ContextPtr);
+    GD = *Data;
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_STOREFLAG: do {
+    auto Op = IROp->C<IR::IROp_StoreFlag>();
+    uint8_t Arg = *GetSrc<uint8_t*>(Op->Header.Args[0]) & 1;
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
+    ContextPtr += Op->Flag;
+    uint8_t *Data = reinterpret_cast<uint8_t*>(ContextPtr);
+    *Data = Arg;
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LOADMEM: do {
+    auto Op = IROp->C<IR::IROp_LoadMem>();
+    void const *Data{};
+    if (Thread->CTX->Config.UnifiedMemory) {
+      Data = *GetSrc<void const**>(Op->Header.Args[0]);
+    }
+    else {
+      Data = Thread->CTX->MemoryMapper.GetPointer<void const*>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+      LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+    }
+    memcpy(GDP, Data, OpSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_STOREMEM: do {
+    #define STORE_DATA(x, y) \
+      case x: { \
+        y *Data{}; \
+        if (Thread->CTX->Config.UnifiedMemory) { \
+          Data = *GetSrc<y**>(Op->Header.Args[0]); \
+        } \
+        else { \
+          Data = Thread->CTX->MemoryMapper.GetPointer<y*>(*GetSrc<uint64_t*>(Op->Header.Args[0])); \
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0])); \
+        } \
+        memcpy(Data, GetSrc<y*>(Op->Header.Args[1]), sizeof(y)); \
+        break; \
+      }
+
+    auto Op = IROp->C<IR::IROp_StoreMem>();
+
+    switch (Op->Size) {
+      STORE_DATA(1, uint8_t)
+      STORE_DATA(2, uint16_t)
+      STORE_DATA(4, uint32_t)
+      STORE_DATA(8, uint64_t)
+      case 16: {
+        void *Data{};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<void**>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<void*>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+
+        void *Src = GetSrc<void*>(Op->Header.Args[1]);
+        memcpy(Data, Src, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unhandled StoreMem size"); break;
+    }
+    #undef STORE_DATA
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_MEMSET: do {
+    auto Op = IROp->C<IR::IROp_MemSet>();
+    BulkMemory::MemSet(GetMemoryPointer(Thread, *GetSrc<uint64_t*>(Op->Header.Args[0])),
+      *GetSrc<uint64_t*>(Op->Header.Args[1]),
+      *GetSrc<uint64_t*>(Op->Header.Args[2]),
+      *GetSrc<uint8_t*>(Op->Header.Args[3]),
+      Op->Size);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_MEMCPY: do {
+    auto Op = IROp->C<IR::IROp_MemCpy>();
+    BulkMemory::MemCpy(GetMemoryPointer(Thread, *GetSrc<uint64_t*>(Op->Header.Args[0])),
+      GetMemoryPointer(Thread, *GetSrc<uint64_t*>(Op->Header.Args[1])),
+      *GetSrc<uint64_t*>(Op->Header.Args[2]),
+      *GetSrc<uint8_t*>(Op->Header.Args[3]),
+      Op->Size);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_MEMCMP: do {
+    auto Op = IROp->C<IR::IROp_MemCmp>();
+    GD = BulkMemory::MemCmp(GetMemoryPointer(Thread, *GetSrc<uint64_t*>(Op->Header.Args[0])),
+      GetMemoryPointer(Thread, *GetSrc<uint64_t*>(Op->Header.Args[1])),
+      *GetSrc<uint64_t*>(Op->Header.Args[2]),
+      *GetSrc<uint8_t*>(Op->Header.Args[3]),
+      Op->Size,
+      Op->StopOnEqual);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_MEMSCAN: do {
+    auto Op = IROp->C<IR::IROp_MemScan>();
+    GD = BulkMemory::MemScan(GetMemoryPointer(Thread, *GetSrc<uint64_t*>(Op->Header.Args[0])),
+      *GetSrc<uint64_t*>(Op->Header.Args[1]),
+      *GetSrc<uint64_t*>(Op->Header.Args[2]),
+      *GetSrc<uint8_t*>(Op->Header.Args[3]),
+      Op->Size,
+      Op->StopOnEqual);
+    break;
+  } while (0);
+  NEXT();
+  #define DO_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(GDP);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    *Dst_d = func(*Src1_d, *Src2_d);          \
+    break;                                            \
+    }
+
+  Handler_OP_ADD: do {
+    auto Op = IROp->C<IR::IROp_Add>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a + b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_SUB: do {
+    auto Op = IROp->C<IR::IROp_Sub>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a - b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_OR: do {
+    auto Op = IROp->C<IR::IROp_Or>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a | b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      DO_OP(16, __uint128_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_AND: do {
+    auto Op = IROp->C<IR::IROp_And>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a & b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_XOR: do {
+    auto Op = IROp->C<IR::IROp_Xor>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    auto Func = [](auto a, auto b) { return a ^ b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LSHL: do {
+    auto Op = IROp->C<IR::IROp_Lshl>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+    uint8_t Mask = OpSize * 8 - 1;
+    GD = Src1 << (Src2 & Mask);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LSHR: do {
+    auto Op = IROp->C<IR::IROp_Lshr>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+    uint8_t Mask = OpSize * 8 - 1;
+    GD = Src1 >> (Src2 & Mask);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ASHR: do {
+    auto Op = IROp->C<IR::IROp_Ashr>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+    uint8_t Mask = OpSize * 8 - 1;
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int8_t>(Src1) >> (Src2 & Mask);
+        break;
+      case 2:
+        GD = static_cast<int16_t>(Src1) >> (Src2 & Mask);
+        break;
+      case 4:
+        GD = static_cast<int32_t>(Src1) >> (Src2 & Mask);
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) >> (Src2 & Mask);
+        break;
+      default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
+    };
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ROR: do {
+    auto Op = IROp->C<IR::IROp_Ror>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+    auto Ror = [] (auto In, auto R) {
+    auto RotateMask = sizeof(In) * 8 - 1;
+      R &= RotateMask;
+      return (In >> R) | (In << (sizeof(In) * 8 - R));
+    };
+
+    switch (OpSize) {
+      case 1:
+        GD = Ror(static_cast<uint8_t>(Src1), static_cast<uint8_t>(Src2));
+        break;
+      case 2:
+        GD = Ror(static_cast<uint16_t>(Src1), static_cast<uint16_t>(Src2));
+        break;
+      case 4:
+        GD = Ror(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
+        break;
+      case 8: {
+        GD = Ror(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
+        break;
+      }
+      default: LogMan::Msg::A("Unknown ROR Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ROL: do {
+    auto Op = IROp->C<IR::IROp_Rol>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+    auto Rol = [] (auto In, auto R) {
+    auto RotateMask = sizeof(In) * 8 - 1;
+      R &= RotateMask;
+      return (In << R) | (In >> (sizeof(In) * 8 - R));
+    };
+
+    switch (OpSize) {
+    case 1:
+      GD = Rol(static_cast<uint8_t>(Src1), static_cast<uint8_t>(Src2));
+      break;
+    case 2:
+      GD = Rol(static_cast<uint16_t>(Src1), static_cast<uint16_t>(Src2));
+      break;
+    case 4:
+      GD = Rol(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
+      break;
+    case 8: {
+      GD = Rol(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
+      break;
+    }
+    default: LogMan::Msg::A("Unknown ROL Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_NEG: do {
+    auto Op = IROp->C<IR::IROp_Neg>();
+    uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    GD = ~Src;
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ZEXT: do {
+    auto Op = IROp->C<IR::IROp_Zext>();
+    LogMan::Throw::A(Op->SrcSize <= 64, "Can't support Zext of size: %ld", Op->SrcSize);
+    uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    if (Op->SrcSize == 64) {
+      // Zext 64bit to 128bit
+      __uint128_t SrcLarge = Src;
+      memcpy(GDP, &SrcLarge, 16);
+    }
+    else {
+      GD = Src & ((1ULL << Op->SrcSize) - 1);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_SEXT: do {
+    auto Op = IROp->C<IR::IROp_Sext>();
+    LogMan::Throw::A(Op->SrcSize <= 64, "Can't support Zext of size: %ld", Op->SrcSize);
+    switch (Op->SrcSize / 8) {
+      case 1:
+        GD = *GetSrc<int8_t*>(Op->Header.Args[0]);
+        break;
+      case 2:
+        GD = *GetSrc<int16_t*>(Op->Header.Args[0]);
+        break;
+      case 4:
+        GD = *GetSrc<int32_t*>(Op->Header.Args[0]);
+        break;
+      case 8:
+        GD = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+        break;
+      default: LogMan::Msg::A("Unknown Sext size: %d", Op->SrcSize / 8);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_MUL: do {
+    auto Op = IROp->C<IR::IROp_Mul>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) * static_cast<int64_t>(static_cast<int8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) * static_cast<int64_t>(static_cast<int16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) * static_cast<int64_t>(Src2);
+        break;
+      case 16: {
+        __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_MULH: do {
+    auto Op = IROp->C<IR::IROp_MulH>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1: {
+        int64_t Tmp = static_cast<int64_t>(static_cast<int8_t>(Src1)) * static_cast<int64_t>(static_cast<int8_t>(Src2));
+        GD = Tmp >> 8;
+        break;
+      }
+      case 2: {
+        int64_t Tmp = static_cast<int64_t>(static_cast<int16_t>(Src1)) * static_cast<int64_t>(static_cast<int16_t>(Src2));
+        GD = Tmp >> 16;
+        break;
+      }
+      case 4: {
+        int64_t Tmp = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
+        GD = Tmp >> 32;
+        break;
+      }
+      case 8: {
+        __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
+        GD = Tmp >> 64;
+      }
+      break;
+      default: LogMan::Msg::A("Unknown MulH Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_UMUL: do {
+    auto Op = IROp->C<IR::IROp_UMul>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint8_t>(Src1) * static_cast<uint8_t>(Src2);
+        break;
+      case 2:
+        GD = static_cast<uint16_t>(Src1) * static_cast<uint16_t>(Src2);
+        break;
+      case 4:
+        GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
+        break;
+      case 16: {
+        __uint128_t Tmp = static_cast<__uint128_t>(static_cast<uint64_t>(Src1)) * static_cast<__uint128_t>(static_cast<uint64_t>(Src2));
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown UMul Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_UMULH: do {
+    auto Op = IROp->C<IR::IROp_UMulH>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint16_t>(Src1) * static_cast<uint16_t>(Src2);
+        GD >>= 8;
+        break;
+      case 2:
+        GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
+        GD >>= 16;
+        break;
+      case 4:
+        GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
+        GD >>= 32;
+        break;
+      case 8: {
+        __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
+        GD = Tmp >> 64;
+        break;
+      }
+      case 16: {
+        // XXX: This is incorrect
+        __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
+        GD = Tmp >> 64;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown UMulH Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_DIV: do {
+    auto Op = IROp->C<IR::IROp_Div>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) / static_cast<int64_t>(static_cast<int8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) / static_cast<int64_t>(static_cast<int16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) / static_cast<int64_t>(static_cast<int32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) / static_cast<int64_t>(Src2);
+        break;
+      case 16: {
+        __int128_t Tmp = *GetSrc<__int128_t*>(Op->Header.Args[0]) / *GetSrc<__int128_t*>(Op->Header.Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_UDIV: do {
+    auto Op = IROp->C<IR::IROp_UDiv>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) / static_cast<uint64_t>(static_cast<uint8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) / static_cast<uint64_t>(static_cast<uint16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) / static_cast<uint64_t>(static_cast<uint32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) / static_cast<uint64_t>(Src2);
+        break;
+      case 16: {
+        __uint128_t Tmp = *GetSrc<__uint128_t*>(Op->Header.Args[0]) / *GetSrc<__uint128_t*>(Op->Header.Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_REM: do {
+    auto Op = IROp->C<IR::IROp_Rem>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) % static_cast<int64_t>(static_cast<int8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) % static_cast<int64_t>(static_cast<int16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) % static_cast<int64_t>(static_cast<int32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) % static_cast<int64_t>(Src2);
+        break;
+      case 16: {
+        __int128_t Tmp = *GetSrc<__int128_t*>(Op->Header.Args[0]) % *GetSrc<__int128_t*>(Op->Header.Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_UREM: do {
+    auto Op = IROp->C<IR::IROp_URem>();
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) % static_cast<uint64_t>(static_cast<uint8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) % static_cast<uint64_t>(static_cast<uint16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) % static_cast<uint64_t>(static_cast<uint32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) % static_cast<uint64_t>(Src2);
+        break;
+      case 16: {
+        __uint128_t Tmp = *GetSrc<__uint128_t*>(Op->Header.Args[0]) % *GetSrc<__uint128_t*>(Op->Header.Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_POPCOUNT: do {
+    auto Op = IROp->C<IR::IROp_Popcount>();
+    uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    GD = __builtin_popcountl(Src);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_FINDLSB: do {
+    auto Op = IROp->C<IR::IROp_FindLSB>();
+    uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Result = __builtin_ffsll(Src);
+    GD = Result - 1;
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_FINDMSB: do {
+    auto Op = IROp->C<IR::IROp_FindMSB>();
+    switch (OpSize) {
+      case 1: GD = ((24 + OpSize * 8) - __builtin_clz(*GetSrc<uint8_t*>(Op->Header.Args[0]))) - 1; break;
+      case 2: GD = ((16 + OpSize * 8) - __builtin_clz(*GetSrc<uint16_t*>(Op->Header.Args[0]))) - 1; break;
+      case 4: GD = (OpSize * 8 - __builtin_clz(*GetSrc<uint32_t*>(Op->Header.Args[0]))) - 1; break;
+      case 8: GD = (OpSize * 8 - __builtin_clzll(*GetSrc<uint64_t*>(Op->Header.Args[0]))) - 1; break;
+      default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_REV: do {
+    auto Op = IROp->C<IR::IROp_Rev>();
+    switch (OpSize) {
+      case 2: GD = __builtin_bswap16(*GetSrc<uint16_t*>(Op->Header.Args[0])); break;
+      case 4: GD = __builtin_bswap32(*GetSrc<uint32_t*>(Op->Header.Args[0])); break;
+      case 8: GD = __builtin_bswap64(*GetSrc<uint64_t*>(Op->Header.Args[0])); break;
+      default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_FINDTRAILINGZEROS: do {
+    auto Op = IROp->C<IR::IROp_FindTrailingZeros>();
+    switch (OpSize) {
+      case 1: {
+        auto Src = *GetSrc<uint8_t*>(Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_ctz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 2: {
+        auto Src = *GetSrc<uint16_t*>(Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_ctz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 4: {
+        auto Src = *GetSrc<uint32_t*>(Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_ctz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 8: {
+        auto Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+        if (Src)
+          GD = __builtin_ctzll(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_BFI: do {
+    auto Op = IROp->C<IR::IROp_Bfi>();
+    uint64_t SourceMask = (1ULL << Op->Width) - 1;
+    if (Op->Width == 64)
+      SourceMask = ~0ULL;
+    uint64_t DestMask = ~(SourceMask << Op->lsb);
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+    uint64_t Res = (Src1 & DestMask) | ((Src2 & SourceMask) << Op->lsb);
+    GD = Res;
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_BFE: do {
+    auto Op = IROp->C<IR::IROp_Bfe>();
+    LogMan::Throw::A(OpSize <= 16, "OpSize is too large for BFE: %d", OpSize);
+    if (OpSize == 16) {
+      LogMan::Throw::A(Op->Width <= 64, "Can't extract width of %d", Op->Width);
+      __uint128_t SourceMask = (1ULL << Op->Width) - 1;
+      if (Op->Width == 64)
+        SourceMask = ~0ULL;
+      SourceMask <<= Op->lsb;
+      __uint128_t Src = (*GetSrc<__uint128_t*>(Op->Header.Args[0]) & SourceMask) >> Op->lsb;
+      memcpy(GDP, &Src, OpSize);
+    }
+    else {
+      uint64_t SourceMask = (1ULL << Op->Width) - 1;
+      if (Op->Width == 64)
+        SourceMask = ~0ULL;
+      SourceMask <<= Op->lsb;
+      uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+      GD = (Src & SourceMask) >> Op->lsb;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_SELECT: do {
+    auto Op = IROp->C<IR::IROp_Select>();
+    bool CompResult = false;
+    uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+    uint64_t ArgTrue = *GetSrc<uint64_t*>(Op->Header.Args[2]);
+    uint64_t ArgFalse = *GetSrc<uint64_t*>(Op->Header.Args[3]);
+
+    switch (Op->Cond.Val) {
+      case FEXCore::IR::COND_EQ:
+        CompResult = Src1 == Src2;
+        break;
+      case FEXCore::IR::COND_NEQ:
+        CompResult = Src1 != Src2;
+        break;
+      case FEXCore::IR::COND_SGE:
+        CompResult = static_cast<int64_t>(Src1) >= static_cast<int64_t>(Src2);
+        break;
+      case FEXCore::IR::COND_SLT:
+        CompResult = static_cast<int64_t>(Src1) < static_cast<int64_t>(Src2);
+        break;
+      case FEXCore::IR::COND_SGT:
+        CompResult = static_cast<int64_t>(Src1) > static_cast<int64_t>(Src2);
+        break;
+      case FEXCore::IR::COND_SLE:
+        CompResult = static_cast<int64_t>(Src1) <= static_cast<int64_t>(Src2);
+        break;
+      case FEXCore::IR::COND_UGE:
+        CompResult = Src1 >= Src2;
+        break;
+      case FEXCore::IR::COND_ULT:
+        CompResult = Src1 < Src2;
+        break;
+      case FEXCore::IR::COND_UGT:
+        CompResult = Src1 > Src2;
+        break;
+      case FEXCore::IR::COND_ULE:
+        CompResult = Src1 <= Src2;
+        break;
+      case FEXCore::IR::COND_MI:
+      case FEXCore::IR::COND_PL:
+      case FEXCore::IR::COND_VS:
+      case FEXCore::IR::COND_VC:
+      default:
+        LogMan::Msg::A("Unsupported compare type");
+        break;
+    }
+    GD = CompResult ? ArgTrue : ArgFalse;
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_EXTRACTELEMENT: do {
+    auto ExtractElementOp = IROp->C<IR::IROp_ExtractElement>();
+
+    uintptr_t DstPtr = reinterpret_cast<uintptr_t>(GDP);
+    uintptr_t SrcPtr = GetSrc<uintptr_t>(ExtractElementOp->Header.Args[0]);
+
+    // Offset to the element offset
+    SrcPtr += IROp->Size * ExtractElementOp->Idx;
+    memcpy(reinterpret_cast<void*>(DstPtr), reinterpret_cast<void*>(SrcPtr), IROp->Size);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_CAS: do {
+    auto Op = IROp->C<IR::IROp_CAS>();
+    auto Size = OpSize;
+    switch (Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
+        }
+
+        uint8_t Src1 = *GetSrc<uint8_t*>(Op->Header.Args[0]);
+        uint8_t Src2 = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+
+        uint8_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
+        }
+
+        uint16_t Src1 = *GetSrc<uint16_t*>(Op->Header.Args[0]);
+        uint16_t Src2 = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+
+        uint16_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
+        }
+
+        uint32_t Src1 = *GetSrc<uint32_t*>(Op->Header.Args[0]);
+        uint32_t Src2 = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+
+        uint32_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
+        }
+
+        uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+        uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+
+        uint64_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICADD: do {
+    auto Op = IROp->C<IR::IROp_AtomicAdd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        *Data += Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Op->Header.Args[0]));
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        *Data += Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        *Data += Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        *Data += Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICSUB: do {
+    auto Op = IROp->C<IR::IROp_AtomicSub>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        *Data -= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        *Data -= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        *Data -= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        *Data -= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICAND: do {
+    auto Op = IROp->C<IR::IROp_AtomicAnd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        *Data &= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        *Data &= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        *Data &= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        *Data &= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICOR: do {
+    auto Op = IROp->C<IR::IROp_AtomicOr>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint8_t*>(Op->Header.Args[0]));
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        *Data |= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Op->Header.Args[0]));
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        *Data |= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        *Data |= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        *Data |= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICXOR: do {
+    auto Op = IROp->C<IR::IROp_AtomicXor>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Op->Header.Args[0]));
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICSWAP: do {
+    auto Op = IROp->C<IR::IROp_AtomicSwap>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        uint8_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        uint16_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        uint32_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        uint64_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICFETCHADD: do {
+    auto Op = IROp->C<IR::IROp_AtomicFetchAdd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICFETCHSUB: do {
+    auto Op = IROp->C<IR::IROp_AtomicFetchSub>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICFETCHAND: do {
+    auto Op = IROp->C<IR::IROp_AtomicFetchAnd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICFETCHOR: do {
+    auto Op = IROp->C<IR::IROp_AtomicFetchOr>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_ATOMICFETCHXOR: do {
+    auto Op = IROp->C<IR::IROp_AtomicFetchXor>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
+        uint8_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        uint16_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        uint32_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        uint64_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    break;
+  } while (0);
+  NEXT();
+  // Vector ops
+  Handler_OP_CREATEVECTOR2: do {
+    auto Op = IROp->C<IR::IROp_CreateVector2>();
+    LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+    uint8_t ElementSize = OpSize / 2;
+    #define CREATE_VECTOR(elementsize, type) \
+      case elementsize: { \
+        auto *Dst_d = reinterpret_cast<type*>(Tmp); \
+        auto *Src1_d = reinterpret_cast<type*>(Src1); \
+        auto *Src2_d = reinterpret_cast<type*>(Src2); \
+        Dst_d[0] = *Src1_d; \
+        Dst_d[1] = *Src2_d; \
+        break; \
+      }
+    switch (ElementSize) {
+      CREATE_VECTOR(1, uint8_t)
+      CREATE_VECTOR(2, uint16_t)
+      CREATE_VECTOR(4, uint32_t)
+      CREATE_VECTOR(8, uint64_t)
+      default: LogMan::Msg::A("Unknown Element Size: %d", ElementSize); break;
+    }
+    #undef CREATE_VECTOR
+    memcpy(GDP, Tmp, OpSize);
+
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_SPLATVECTOR4:
+  Handler_OP_SPLATVECTOR3:
+  Handler_OP_SPLATVECTOR2: do {
+    auto Op = IROp->C<IR::IROp_SplatVector2>();
+    LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+    uint8_t Elements = 0;
+
+    switch (Op->Header.Op) {
+      case IR::OP_SPLATVECTOR4: Elements = 4; break;
+      case IR::OP_SPLATVECTOR3: Elements = 3; break;
+      case IR::OP_SPLATVECTOR2: Elements = 2; break;
+      default: LogMan::Msg::A("Uknown Splat size"); break;
+    }
+
+    #define CREATE_VECTOR(elementsize, type) \
+      case elementsize: { \
+        auto *Dst_d = reinterpret_cast<type*>(Tmp); \
+        auto *Src_d = reinterpret_cast<type*>(Src); \
+        for (uint8_t i = 0; i < Elements; ++i) \
+          Dst_d[i] = *Src_d;\
+        break; \
+      }
+    uint8_t ElementSize = OpSize / Elements;
+    switch (ElementSize) {
+      CREATE_VECTOR(1, uint8_t)
+      CREATE_VECTOR(2, uint16_t)
+      CREATE_VECTOR(4, uint32_t)
+      CREATE_VECTOR(8, uint64_t)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.Size); break;
+    }
+    #undef CREATE_VECTOR
+    memcpy(GDP, Tmp, OpSize);
+
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VOR: do {
+    auto Op = IROp->C<IR::IROp_VOr>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
+
+    __uint128_t Dst = Src1 | Src2;
+    memcpy(GDP, &Dst, 16);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VAND: do {
+    auto Op = IROp->C<IR::IROp_VAnd>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
+
+    __uint128_t Dst = Src1 & Src2;
+    memcpy(GDP, &Dst, 16);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VXOR: do {
+    auto Op = IROp->C<IR::IROp_VXor>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
+
+    __uint128_t Dst = Src1 ^ Src2;
+    memcpy(GDP, &Dst, 16);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSLI: do {
+    auto Op = IROp->C<IR::IROp_VSLI>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+    __uint128_t Src2 = Op->ByteShift * 8;
+
+    __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 << Src2;
+    memcpy(GDP, &Dst, 16);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSRI: do {
+    auto Op = IROp->C<IR::IROp_VSRI>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+    __uint128_t Src2 = Op->ByteShift * 8;
+
+    __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 >> Src2;
+    memcpy(GDP, &Dst, 16);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VNOT: do {
+    auto Op = IROp->C<IR::IROp_VNot>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+
+    __uint128_t Dst = ~Src1;
+    memcpy(GDP, &Dst, 16);
+    break;
+  } while (0);
+  NEXT();
+  #define DO_VECTOR_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_SCALAR_OP(size, type, func)\
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], *Src2_d);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_1SRC_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type*>(Src); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_SAT_OP(size, type, func, min, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], Src2_d[i], min, max);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  Handler_OP_VUSHRI: do {
+    auto Op = IROp->C<IR::IROp_VUShrI>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(1, uint8_t, Func)
+      DO_VECTOR_1SRC_OP(2, uint16_t, Func)
+      DO_VECTOR_1SRC_OP(4, uint32_t, Func)
+      DO_VECTOR_1SRC_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSSHRI: do {
+    auto Op = IROp->C<IR::IROp_VSShrI>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> BitShift; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(1, int8_t, Func)
+      DO_VECTOR_1SRC_OP(2, int16_t, Func)
+      DO_VECTOR_1SRC_OP(4, int32_t, Func)
+      DO_VECTOR_1SRC_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSHLI: do {
+    auto Op = IROp->C<IR::IROp_VShlI>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : (a << BitShift); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(1, uint8_t, Func)
+      DO_VECTOR_1SRC_OP(2, uint16_t, Func)
+      DO_VECTOR_1SRC_OP(4, uint32_t, Func)
+      DO_VECTOR_1SRC_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+
+  Handler_OP_VADD: do {
+    auto Op = IROp->C<IR::IROp_VAdd>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a + b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSUB: do {
+    auto Op = IROp->C<IR::IROp_VSub>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a - b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUQADD: do {
+    auto Op = IROp->C<IR::IROp_VUQAdd>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      decltype(a) res = a + b;
+      return res < a ? ~0U : res;
+    };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUQSUB: do {
+    auto Op = IROp->C<IR::IROp_VUQSub>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      decltype(a) res = a - b;
+      return res > a ? 0U : res;
+    };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSQADD: do {
+    auto Op = IROp->C<IR::IROp_VSQAdd>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      decltype(a) res = a + b;
+
+      if (a > 0) {
+        if (b > (std::numeric_limits<decltype(a)>::max() - a)) {
+          return std::numeric_limits<decltype(a)>::max();
+        }
+      }
+      else if (b < (std::numeric_limits<decltype(a)>::min() - a)) {
+        return std::numeric_limits<decltype(a)>::min();
+      }
+
+      return res;
+    };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFADD: do {
+    auto Op = IROp->C<IR::IROp_VFAdd>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a + b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFSUB: do {
+    auto Op = IROp->C<IR::IROp_VFSub>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a - b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFMUL: do {
+    auto Op = IROp->C<IR::IROp_VFMul>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFDIV: do {
+    auto Op = IROp->C<IR::IROp_VFDiv>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a / b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFMIN: do {
+    auto Op = IROp->C<IR::IROp_VFMin>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return std::min(a, b); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFMAX: do {
+    auto Op = IROp->C<IR::IROp_VFMax>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return std::max(a, b); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFRECP: do {
+    auto Op = IROp->C<IR::IROp_VFRecp>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a) { return 1.0 / a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFSQRT: do {
+    auto Op = IROp->C<IR::IROp_VFSqrt>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a) { return std::sqrt(a); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFRSQRT: do {
+    auto Op = IROp->C<IR::IROp_VFRSqrt>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a) { return 1.0 / std::sqrt(a); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  #define DO_VECTOR_1SRC_2TYPE_OP(size, type, type2, func, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type2*>(Src); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func(Src_d[i], max);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_1SRC_2TYPE_OP_TOP(size, type, type2, func, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type2*>(Src2); \
+    memcpy(Dst_d, Src1, Elements * sizeof(type2));\
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i+Elements] = (type)func(Src_d[i], max);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_2SRC_2TYPE_OP(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type2*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type2*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func((type)Src1_d[i], (type)Src2_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  Handler_OP_VSQXTUN: do {
+    auto Op = IROp->C<IR::IROp_VSQXTUN>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))0); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(2, uint8_t, int16_t, Func, (1 << 8) - 1)
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint16_t, int32_t, Func, (1 << 16) - 1)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSQXTUN2: do {
+    auto Op = IROp->C<IR::IROp_VSQXTUN2>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))0); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint8_t, int16_t, Func, (1 << 8) - 1)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(4, uint16_t, int32_t, Func, (1 << 16) - 1)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUCVTF: do {
+    auto Op = IROp->C<IR::IROp_VUCVTF>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, float, uint32_t, Func, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, double, uint64_t, Func, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSCVTF: do {
+    auto Op = IROp->C<IR::IROp_VSCVTF>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, float, int32_t, Func, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, double, int64_t, Func, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUMULL: do {
+    auto Op = IROp->C<IR::IROp_VUMull>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP(1, uint16_t, uint8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(2, uint32_t, uint16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(4, uint64_t, uint32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSMULL: do {
+    auto Op = IROp->C<IR::IROp_VSMull>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP(1, int16_t, int8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(2, int32_t, int16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(4, int64_t, int32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFCVTL: do {
+    auto Op = IROp->C<IR::IROp_VFCVTL>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, double, float, Func, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFCVTN: do {
+    auto Op = IROp->C<IR::IROp_VFCVTN>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(8, float, double, Func, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSXTL: do {
+    auto Op = IROp->C<IR::IROp_VSXTL>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(1, int16_t, int8_t, Func,  0)
+      DO_VECTOR_1SRC_2TYPE_OP(2, int32_t, int16_t, Func, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(4, int64_t, int32_t, Func, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUXTL: do {
+    auto Op = IROp->C<IR::IROp_VUXTL>();
+    void *Src = GetSrc<void*>(Op->Header.Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(1, uint16_t, uint8_t, Func,  0)
+      DO_VECTOR_1SRC_2TYPE_OP(2, uint32_t, uint16_t, Func, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint64_t, uint32_t, Func, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUMIN: do {
+    auto Op = IROp->C<IR::IROp_VUMin>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return std::min(a, b); };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSMIN: do {
+    auto Op = IROp->C<IR::IROp_VSMin>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return std::min(a, b); };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUMAX: do {
+    auto Op = IROp->C<IR::IROp_VUMax>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return std::max(a, b); };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSMAX: do {
+    auto Op = IROp->C<IR::IROp_VSMax>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return std::max(a, b); };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUSHL: do {
+    auto Op = IROp->C<IR::IROp_VUShl>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSSHR: do {
+    auto Op = IROp->C<IR::IROp_VSShr>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+
+  Handler_OP_VUSHLS: do {
+    auto Op = IROp->C<IR::IROp_VUShlS>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
+      DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
+      DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
+      DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
+      DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUSHRS: do {
+    auto Op = IROp->C<IR::IROp_VUShrS>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
+      DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
+      DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
+      DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
+      DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VSSHRS: do {
+    auto Op = IROp->C<IR::IROp_VSShrS>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_SCALAR_OP(1, int8_t, Func)
+      DO_VECTOR_SCALAR_OP(2, int16_t, Func)
+      DO_VECTOR_SCALAR_OP(4, int32_t, Func)
+      DO_VECTOR_SCALAR_OP(8, int64_t, Func)
+      DO_VECTOR_SCALAR_OP(16, __int128_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VUSHR: do {
+    auto Op = IROp->C<IR::IROp_VUShr>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return a >> b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VZIP2:
+  Handler_OP_VZIP: do {
+    auto Op = IROp->C<IR::IROp_VZip>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    uint8_t BaseOffset = IROp->Op == IR::OP_VZIP2 ? (Elements / 2) : 0;
+    Elements >>= 1;
+
+    switch (Op->ElementSize) {
+      case 1: {
+        auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint8_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      case 2: {
+        auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint16_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      case 4: {
+        auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint32_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      case 8: {
+        auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint64_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VINSELEMENT: do {
+    auto Op = IROp->C<IR::IROp_VInsElement>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    // Copy src1 in to dest
+    memcpy(Tmp, Src1, Op->RegisterSize);
+    switch (Op->ElementSize) {
+      case 1: {
+        auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      case 2: {
+        auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      case 4: {
+        auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      case 8: {
+        auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    };
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VCMPEQ: do {
+    auto Op = IROp->C<IR::IROp_VCMPEQ>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,   Func)
+      DO_VECTOR_OP(2, uint16_t,  Func)
+      DO_VECTOR_OP(4, uint32_t,  Func)
+      DO_VECTOR_OP(8, uint64_t,  Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VCMPGT: do {
+    auto Op = IROp->C<IR::IROp_VCMPGT>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return a > b ? ~0ULL : 0; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,   Func)
+      DO_VECTOR_OP(2, int16_t,  Func)
+      DO_VECTOR_OP(4, int32_t,  Func)
+      DO_VECTOR_OP(8, int64_t,  Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LUDIV: do {
+    auto Op = IROp->C<IR::IROp_LUDiv>();
+    // Each source is OpSize in size
+    // So you can have up to a 128bit divide from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(Op->Header.Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        uint16_t Divisor = *GetSrc<uint16_t*>(Op->Header.Args[2]);
+        uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        uint32_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint16_t>(Res);
+        break;
+      }
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        uint32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
+        uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        uint64_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        uint64_t Divisor = *GetSrc<uint64_t*>(Op->Header.Args[2]);
+        __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
+        __uint128_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LUDIV Size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LDIV: do {
+    auto Op = IROp->C<IR::IROp_LDiv>();
+    // Each source is OpSize in size
+    // So you can have up to a 128bit divide from x86-64
+    switch (OpSize) {
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        int32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
+        int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        int64_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        int64_t Divisor = *GetSrc<int64_t*>(Op->Header.Args[2]);
+        __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
+        __int128_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LDIV Size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LUREM: do {
+    auto Op = IROp->C<IR::IROp_LURem>();
+    // Each source is OpSize in size
+    // So you can have up to a 128bit Remainder from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(Op->Header.Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(Op->Header.Args[1]);
+        uint16_t Divisor = *GetSrc<uint16_t*>(Op->Header.Args[2]);
+        uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        uint32_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint16_t>(Res);
+        break;
+      }
+
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        uint32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
+        uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        uint64_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        uint64_t Divisor = *GetSrc<uint64_t*>(Op->Header.Args[2]);
+        __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
+        __uint128_t Res = Source % Divisor;
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LUREM Size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_LREM: do {
+    auto Op = IROp->C<IR::IROp_LRem>();
+    // Each source is OpSize in size
+    // So you can have up to a 128bit Remainder from x86-64
+    switch (OpSize) {
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
+        int32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
+        int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        int64_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
+        int64_t Divisor = *GetSrc<int64_t*>(Op->Header.Args[2]);
+        __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
+        __int128_t Res = Source % Divisor;
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LREM Size: %d", OpSize); break;
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VEXTR: do {
+    auto Op = IROp->C<IR::IROp_VExtr>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
+
+    uint64_t Offset = Op->Index * Op->ElementSize * 8;
+    __uint128_t Dst = (Src1 << (sizeof(__uint128_t) * 8 - Offset)) | (Src2 >> Offset);
+
+    memcpy(GDP, &Dst, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VINSGPR: do {
+    auto Op = IROp->C<IR::IROp_VInsGPR>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
+
+    uint64_t Offset = Op->Index * Op->ElementSize * 8;
+    __uint128_t Mask = (1ULL << (Op->ElementSize * 8)) - 1;
+    Mask <<= Offset;
+    Mask = ~Mask;
+    __uint128_t Dst = Src1 & Mask;
+    Dst |= Src2 << Offset;
+
+    memcpy(GDP, &Dst, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+
+  Handler_OP_SCVTF: do {
+    auto Op = IROp->C<IR::IROp_SCVTF>();
+    if (Op->ElementSize == 8) {
+      double Dst = (double)*GetSrc<int64_t*>(Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    else {
+      float Dst = (float)*GetSrc<int32_t*>(Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_FCVTZS: do {
+    auto Op = IROp->C<IR::IROp_SCVTF>();
+    if (Op->ElementSize == 8) {
+      int64_t Dst = (int64_t)*GetSrc<double*>(Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    else {
+      int32_t Dst = (int32_t)*GetSrc<float*>(Op->Header.Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_FCVTF: do {
+    auto Op = IROp->C<IR::IROp_FCVTF>();
+    uint16_t Conv = (Op->DstElementSize << 8) | Op->SrcElementSize;
+    switch (Conv) {
+      case 0x0804: { // Double <- Float
+        double Dst = (double)*GetSrc<float*>(Op->Header.Args[0]);
+        memcpy(GDP, &Dst, 8);
+        break;
+      }
+      case 0x0408: { // Float <- Double
+        float Dst = (float)*GetSrc<double*>(Op->Header.Args[0]);
+        memcpy(GDP, &Dst, 4);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown FCVT sizes: 0x%x", Conv);
+    }
+    break;
+  } while (0);
+  NEXT();
+  #define DO_SCALAR_COMPARE_OP(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    Dst_d[0] = func(Src1_d[0], Src2_d[0]);          \
+    break;                                            \
+    }
+
+  #define DO_VECTOR_COMPARE_OP(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  Handler_OP_VFCMPEQ: do {
+    auto Op = IROp->C<IR::IROp_VFCMPEQ>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+
+    auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFCMPNEQ: do {
+    auto Op = IROp->C<IR::IROp_VFCMPNEQ>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+
+    auto Func = [](auto a, auto b) { return a != b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+  Handler_OP_VFCMPLT: do {
+    auto Op = IROp->C<IR::IROp_VFCMPLT>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+
+    auto Func = [](auto a, auto b) { return a < b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+
+  Handler_OP_VFCMPLE: do {
+    auto Op = IROp->C<IR::IROp_VFCMPLE>();
+    void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
+    void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
+
+    auto Func = [](auto a, auto b) { return a <= b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    break;
+  } while (0);
+  NEXT();
+
+  Handler_Unhandled: {
+    LogMan::Msg::A("Unknown IR Op: %d(%s)", IROp->Op, FEXCore::IR::GetName(IROp->Op).data());
+    NEXT();
+  }
+
+#undef NEXT
+#undef DISPATCH
+#undef GDP
+#undef GD
+
+  Handler_Exit:
   Thread->Stats.InstructionsExecuted.fetch_add(DebugData->second.GuestInstructionCount);
 }
 
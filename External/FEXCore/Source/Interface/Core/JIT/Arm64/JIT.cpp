@@ -6,6 +6,7 @@
 #include "Interface/HLE/Syscalls.h"
 
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
+#include "Interface/Memory/HugePages.h"
 
 #if _M_X86_64
 #define VIXL_INCLUDE_SIMULATOR_AARCH64
@@ -72,6 +73,31 @@ static uint64_t CompileFallbackBlockThunk(FEXCore::Context::Context* CTX, FEXCor
   return Result;
 }
 
+static bool CanInlineConstant(FEXCore::IR::IROp_Header const *IROp, uint8_t Arg, uint64_t Constant) {
+  switch (IROp->Op) {
+  case IR::OP_ADD:
+  case IR::OP_SUB:
+  case IR::OP_SELECT:
+    return Arg == 1 && Assembler::IsImmAddSub(Constant);
+  case IR::OP_AND:
+  case IR::OP_OR:
+  case IR::OP_XOR:
+    return Arg == 1 && Assembler::IsImmLogical(Constant, 64);
+  case IR::OP_LSHL:
+  case IR::OP_LSHR:
+  case IR::OP_ASHR:
+    // Shift amounts get masked anyway
+    return Arg == 1;
+  case IR::OP_STOREMEM:
+    // Zero gets stored straight from the zero register
+    return Arg == 1 && IROp->C<IR::IROp_StoreMem>()->Class.Val == 0 && Constant == 0;
+  case IR::OP_STORECONTEXT:
+    return Arg == 0 && IROp->C<IR::IROp_StoreContext>()->Class.Val == 0 && Constant == 0;
+  default:
+    return false;
+  }
+}
+
 // XXX: Switch from MacroAssembler to Assembler once we drop the simulator
 class JITCore final : public CPUBackend, public vixl::aarch64::MacroAssembler  {
 public:
@@ -135,6 +161,24 @@ private:
   aarch64::VRegister GetSrc(uint32_t Node);
   aarch64::VRegister GetDst(uint32_t Node);
 
+  /**
+   * @brief Returns true if the RA left this argument as a constant for us to encode
+   * The constant's value is written to Value
+   */
+  bool IsInlineConstant(IR::OrderedNodeWrapper const &Node, uint64_t *Value);
+
+  /**
+   * @brief GetSrc for stores, inline constants are always zero there so they come from the zero register
+   */
+  template<uint8_t RAType>
+  aarch64::Register GetStoreSrc(IR::OrderedNodeWrapper const &Node);
+
+  /**
+   * @brief Loads or stores a single string op element of Size bytes, loads are zero extended
+   */
+  void LoadStringElement(aarch64::Register const &Dst, aarch64::Register const &Ptr, uint8_t Size);
+  void StoreStringElement(aarch64::Register const &Src, aarch64::Register const &Ptr, uint8_t Size);
+
   struct LiveRange {
     uint32_t Begin;
     uint32_t End;
@@ -208,10 +252,15 @@ JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadSt
 
   RAPass->AddRegisters(GPRClass, NumGPRs);
   RAPass->AddRegisters(FPRClass, NumFPRs);
+  RAPass->SetInlineConstantCheck(CanInlineConstant);
 
   // Just set the entire range as executable
   auto Buffer = GetBuffer();
   mprotect(Buffer->GetOffsetAddress<void*>(0), Buffer->GetCapacity(), PROT_READ | PROT_WRITE | PROT_EXEC);
+  if (CTX->Config.HugePages) {
+    // vixl owns the buffer, so only the huge page aligned part of it can be advised
+    FEXCore::Memory::AdviseHugePages(Buffer->GetOffsetAddress<void*>(0), Buffer->GetCapacity());
+  }
 #if DEBUG
   Decoder.AppendVisitor(&Disasm)
 #endif
@@ -250,6 +299,26 @@ uint32_t JITCore::GetPhys(uint32_t Node) {
   return ~0U;
 }
 
+void JITCore::LoadStringElement(aarch64::Register const &Dst, aarch64::Register const &Ptr, uint8_t Size) {
+  switch (Size) {
+  case 1: ldrb(Dst.W(), MemOperand(Ptr)); break;
+  case 2: ldrh(Dst.W(), MemOperand(Ptr)); break;
+  case 4: ldr(Dst.W(), MemOperand(Ptr)); break;
+  case 8: ldr(Dst.X(), MemOperand(Ptr)); break;
+  default: LogMan::Msg::A("Unhandled string op size: %d", Size); break;
+  }
+}
+
+void JITCore::StoreStringElement(aarch64::Register const &Src, aarch64::Register const &Ptr, uint8_t Size) {
+  switch (Size) {
+  case 1: strb(Src.W(), MemOperand(Ptr)); break;
+  case 2: strh(Src.W(), MemOperand(Ptr)); break;
+  case 4: str(Src.W(), MemOperand(Ptr)); break;
+  case 8: str(Src.X(), MemOperand(Ptr)); break;
+  default: LogMan::Msg::A("Unhandled string op size: %d", Size); break;
+  }
+}
+
 template<uint8_t RAType>
 aarch64::Register JITCore::GetSrc(uint32_t Node) {
   uint32_t Reg = GetPhys(Node);
@@ -278,6 +347,24 @@ aarch64::VRegister JITCore::GetDst(uint32_t Node) {
   return RAFPR[Reg];
 }
 
+bool JITCore::IsInlineConstant(IR::OrderedNodeWrapper const &Node, uint64_t *Value) {
+  if (!RAPass->IsInlineConstant(Node.ID())) {
+    return false;
+  }
+
+  auto Op = Node.GetNode(CurrentIR->GetListData())->Op(CurrentIR->GetData())->C<IR::IROp_Constant>();
+  *Value = Op->Constant;
+  return true;
+}
+
+template<uint8_t RAType>
+aarch64::Register JITCore::GetStoreSrc(IR::OrderedNodeWrapper const &Node) {
+  if (RAPass->IsInlineConstant(Node.ID())) {
+    return RAType == RA_64 ? xzr : wzr;
+  }
+  return GetSrc<RAType>(Node.ID());
+}
+
 void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData) {
   using namespace aarch64;
   JumpTargets.clear();
@@ -376,7 +463,10 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         for (uint8_t i = 0; i < NumArgs; ++i) {
           uint32_t ArgNode = IROp->Args[i].ID();
           uint64_t PhysReg = RAPass->GetNodeRegister(ArgNode);
-          if (PhysReg >= FPRBase)
+          uint64_t Const;
+          if (IsInlineConstant(IROp->Args[i], &Const))
+            Inst << "#0x" << std::hex << Const << std::dec << (i + 1 == NumArgs ? "" : ", ");
+          else if (PhysReg >= FPRBase)
             Inst << "FPR" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
           else
             Inst << "Reg" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
@@ -412,8 +502,8 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         ret();
         break;
       }
-      case IR::OP_SYSCALL: {
-        auto Op = IROp->C<IR::IROp_Syscall>();
+      case IR::OP_SYSCALL:
+      case IR::OP_SYSCALLDIRECT: {
         // Arguments are passed as follows:
         // X0: SyscallHandler
         // X1: ThreadState
@@ -423,7 +513,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
         sub(sp, sp, SPOffset);
         for (uint32_t i = 0; i < 7; ++i)
-          str(GetSrc<RA_64>(Op->Header.Args[i].ID()), MemOperand(sp, 0 + i * 8));
+          str(GetSrc<RA_64>(IROp->Args[i].ID()), MemOperand(sp, 0 + i * 8));
 
         int i = 0;
         for (auto RA : RA64) {
@@ -437,17 +527,24 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         mov(x2, sp);
 
 #if _M_X86_64
+        // The simulator can only call out through the generic thunk, which handles every syscall
         CallRuntime(SyscallThunk);
 #else
-        using ClassPtrType = uint64_t (FEXCore::SyscallHandler::*)(FEXCore::Core::InternalThreadState *, FEXCore::HLE::SyscallArguments *);
-        union PtrCast {
-          ClassPtrType ClassPtr;
-          uintptr_t Data;
-        };
-
-        PtrCast Ptr;
-        Ptr.ClassPtr = &FEXCore::SyscallHandler::HandleSyscall;
-        LoadConstant(x3, Ptr.Data);
+        if (IROp->Op == IR::OP_SYSCALLDIRECT) {
+          auto Op = IROp->C<IR::IROp_SyscallDirect>();
+          LoadConstant(x3, reinterpret_cast<uintptr_t>(FEXCore::SyscallHandler::GetDirectHandler(Op->Syscall)));
+        }
+        else {
+          using ClassPtrType = uint64_t (FEXCore::SyscallHandler::*)(FEXCore::Core::InternalThreadState *, FEXCore::HLE::SyscallArguments *);
+          union PtrCast {
+            ClassPtrType ClassPtr;
+            uintptr_t Data;
+          };
+
+          PtrCast Ptr;
+          Ptr.ClassPtr = &FEXCore::SyscallHandler::HandleSyscall;
+          LoadConstant(x3, Ptr.Data);
+        }
         blr(x3);
 #endif
 
@@ -633,16 +730,16 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         if (Op->Class.Val == 0) {
           switch (Op->Size) {
           case 1:
-            strb(GetSrc<RA_32>(Op->Header.Args[0].ID()), MemOperand(STATE, Op->Offset));
+            strb(GetStoreSrc<RA_32>(Op->Header.Args[0]), MemOperand(STATE, Op->Offset));
           break;
           case 2:
-            strh(GetSrc<RA_32>(Op->Header.Args[0].ID()), MemOperand(STATE, Op->Offset));
+            strh(GetStoreSrc<RA_32>(Op->Header.Args[0]), MemOperand(STATE, Op->Offset));
           break;
           case 4:
-            str(GetSrc<RA_32>(Op->Header.Args[0].ID()), MemOperand(STATE, Op->Offset));
+            str(GetStoreSrc<RA_32>(Op->Header.Args[0]), MemOperand(STATE, Op->Offset));
           break;
           case 8:
-            str(GetSrc<RA_64>(Op->Header.Args[0].ID()), MemOperand(STATE, Op->Offset));
+            str(GetStoreSrc<RA_64>(Op->Header.Args[0]), MemOperand(STATE, Op->Offset));
           break;
           default:  LogMan::Msg::A("Unhandled StoreContext size: %d", Op->Size);
           }
@@ -761,6 +858,10 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         break;
       }
       case IR::OP_CONSTANT: {
+        // Every use encodes these itself
+        if (RAPass->IsInlineConstant(Node)) {
+          break;
+        }
         auto Op = IROp->C<IR::IROp_Constant>();
         auto Dst = GetDst<RA_64>(Node);
         LoadConstant(Dst, Op->Constant);
@@ -768,7 +869,11 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       }
       case IR::OP_ADD: {
         auto Op = IROp->C<IR::IROp_Add>();
-        add(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        uint64_t Const;
+        if (IsInlineConstant(Op->Header.Args[1], &Const))
+          add(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), Const);
+        else
+          add(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
         break;
       }
       case IR::OP_NEG: {
@@ -778,22 +883,38 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       }
       case IR::OP_SUB: {
         auto Op = IROp->C<IR::IROp_Sub>();
-        sub(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        uint64_t Const;
+        if (IsInlineConstant(Op->Header.Args[1], &Const))
+          sub(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), Const);
+        else
+          sub(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
         break;
       }
       case IR::OP_AND: {
         auto Op = IROp->C<IR::IROp_And>();
-        and_(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        uint64_t Const;
+        if (IsInlineConstant(Op->Header.Args[1], &Const))
+          and_(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), Const);
+        else
+          and_(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
         break;
       }
       case IR::OP_XOR: {
         auto Op = IROp->C<IR::IROp_Xor>();
-        eor(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        uint64_t Const;
+        if (IsInlineConstant(Op->Header.Args[1], &Const))
+          eor(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), Const);
+        else
+          eor(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
         break;
       }
       case IR::OP_OR: {
         auto Op = IROp->C<IR::IROp_Or>();
-        orr(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        uint64_t Const;
+        if (IsInlineConstant(Op->Header.Args[1], &Const))
+          orr(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), Const);
+        else
+          orr(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
         break;
       }
       case IR::OP_MOV: {
@@ -803,7 +924,15 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       }
       case IR::OP_LSHR: {
         auto Op = IROp->C<IR::IROp_Lshr>();
-        if (OpSize == 8)
+        uint64_t Const;
+        if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+          // Same masking as the register form does
+          if (OpSize == 8)
+            lsr(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), Const & 63);
+          else
+            lsr(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), Const & 31);
+        }
+        else if (OpSize == 8)
           lsrv(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
         else
           lsrv(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), GetSrc<RA_32>(Op->Header.Args[1].ID()));
@@ -811,7 +940,15 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       }
       case IR::OP_ASHR: {
         auto Op = IROp->C<IR::IROp_Ashr>();
-        if (OpSize == 8)
+        uint64_t Const;
+        if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+          // Same masking as the register form does
+          if (OpSize == 8)
+            asr(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), Const & 63);
+          else
+            asr(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), Const & 31);
+        }
+        else if (OpSize == 8)
           asrv(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
         else
           asrv(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), GetSrc<RA_32>(Op->Header.Args[1].ID()));
@@ -819,7 +956,15 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       }
       case IR::OP_LSHL: {
         auto Op = IROp->C<IR::IROp_Lshl>();
-        if (OpSize == 8)
+        uint64_t Const;
+        if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+          // Same masking as the register form does
+          if (OpSize == 8)
+            lsl(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), Const & 63);
+          else
+            lsl(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), Const & 31);
+        }
+        else if (OpSize == 8)
           lslv(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
         else
           lslv(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()), GetSrc<RA_32>(Op->Header.Args[1].ID()));
@@ -1264,7 +1409,11 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       case IR::OP_SELECT: {
         auto Op = IROp->C<IR::IROp_Select>();
 
-        cmp(GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        uint64_t Const;
+        if (IsInlineConstant(Op->Header.Args[1], &Const))
+          cmp(GetSrc<RA_64>(Op->Header.Args[0].ID()), Const);
+        else
+          cmp(GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()));
 
         switch (Op->Cond.Val) {
         case FEXCore::IR::COND_EQ:
@@ -1352,21 +1501,128 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         break;
       }
+      case IR::OP_MEMSET: {
+        auto Op = IROp->C<IR::IROp_MemSet>();
+        // x0 = Dest, x1 = Remaining elements, x2 = Pointer step
+        add(x0, MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+        mov(x1, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+        LoadConstant(x2, Op->Size);
+        cmp(GetSrc<RA_64>(Op->Header.Args[3].ID()), 0);
+        csneg(x2, x2, x2, eq);
+
+        Label Loop, Done;
+        cbz(x1, &Done);
+        bind(&Loop);
+        StoreStringElement(GetSrc<RA_64>(Op->Header.Args[1].ID()), x0, Op->Size);
+        add(x0, x0, x2);
+        sub(x1, x1, 1);
+        cbnz(x1, &Loop);
+        bind(&Done);
+        break;
+      }
+      case IR::OP_MEMCPY: {
+        auto Op = IROp->C<IR::IROp_MemCpy>();
+        // Element by element so overlapping copies behave like the guest expects
+        // x0 = Dest, x3 = Src, x1 = Remaining elements, x2 = Pointer step, x19 = Element
+        stp(x19, x20, MemOperand(sp, -16, PreIndex));
+        add(x0, MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+        add(x3, MEM_BASE, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        mov(x1, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+        LoadConstant(x2, Op->Size);
+        cmp(GetSrc<RA_64>(Op->Header.Args[3].ID()), 0);
+        csneg(x2, x2, x2, eq);
+
+        Label Loop, Done;
+        cbz(x1, &Done);
+        bind(&Loop);
+        LoadStringElement(x19, x3, Op->Size);
+        StoreStringElement(x19, x0, Op->Size);
+        add(x0, x0, x2);
+        add(x3, x3, x2);
+        sub(x1, x1, 1);
+        cbnz(x1, &Loop);
+        bind(&Done);
+        ldp(x19, x20, MemOperand(sp, 16, PostIndex));
+        break;
+      }
+      case IR::OP_MEMCMP: {
+        auto Op = IROp->C<IR::IROp_MemCmp>();
+        // x0 = Src1, x3 = Src2, x1 = Remaining elements, x20 = Pointer step, x2 and x19 = Elements
+        stp(x19, x20, MemOperand(sp, -16, PreIndex));
+        add(x0, MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+        add(x3, MEM_BASE, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        mov(x1, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+        LoadConstant(x20, Op->Size);
+        cmp(GetSrc<RA_64>(Op->Header.Args[3].ID()), 0);
+        csneg(x20, x20, x20, eq);
+
+        Label Loop, Done;
+        cbz(x1, &Done);
+        bind(&Loop);
+        LoadStringElement(x2, x0, Op->Size);
+        LoadStringElement(x19, x3, Op->Size);
+        add(x0, x0, x20);
+        add(x3, x3, x20);
+        sub(x1, x1, 1);
+        cmp(x2, x19);
+        b(&Done, Op->StopOnEqual ? eq : ne);
+        cbnz(x1, &Loop);
+        bind(&Done);
+        ldp(x19, x20, MemOperand(sp, 16, PostIndex));
+
+        // Elements compared is what we started with minus what remains
+        sub(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[2].ID()), x1);
+        break;
+      }
+      case IR::OP_MEMSCAN: {
+        auto Op = IROp->C<IR::IROp_MemScan>();
+        // x0 = Src, x1 = Remaining elements, x20 = Pointer step, x2 = Element, x19 = Value
+        stp(x19, x20, MemOperand(sp, -16, PreIndex));
+        add(x0, MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+        mov(x1, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+        LoadConstant(x20, Op->Size);
+        cmp(GetSrc<RA_64>(Op->Header.Args[3].ID()), 0);
+        csneg(x20, x20, x20, eq);
+
+        auto Value = GetSrc<RA_64>(Op->Header.Args[1].ID());
+        switch (Op->Size) {
+        case 1: uxtb(w19, Value.W()); break;
+        case 2: uxth(w19, Value.W()); break;
+        case 4: mov(w19, Value.W()); break;
+        case 8: mov(x19, Value); break;
+        default: LogMan::Msg::A("Unhandled MemScan size: %d", Op->Size); break;
+        }
+
+        Label Loop, Done;
+        cbz(x1, &Done);
+        bind(&Loop);
+        LoadStringElement(x2, x0, Op->Size);
+        add(x0, x0, x20);
+        sub(x1, x1, 1);
+        cmp(x2, x19);
+        b(&Done, Op->StopOnEqual ? eq : ne);
+        cbnz(x1, &Loop);
+        bind(&Done);
+        ldp(x19, x20, MemOperand(sp, 16, PostIndex));
+
+        sub(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[2].ID()), x1);
+        break;
+      }
       case IR::OP_STOREMEM: {
         auto Op = IROp->C<IR::IROp_StoreMem>();
         if (Op->Class.Val == 0) {
           switch (Op->Size) {
           case 1:
-            strb(GetSrc<RA_64>(Op->Header.Args[1].ID()), MemOperand(MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID())));
+            strb(GetStoreSrc<RA_32>(Op->Header.Args[1]), MemOperand(MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID())));
           break;
           case 2:
-            strh(GetSrc<RA_64>(Op->Header.Args[1].ID()), MemOperand(MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID())));
+            strh(GetStoreSrc<RA_32>(Op->Header.Args[1]), MemOperand(MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID())));
           break;
           case 4:
-            str(GetSrc<RA_32>(Op->Header.Args[1].ID()), MemOperand(MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID())));
+            str(GetStoreSrc<RA_32>(Op->Header.Args[1]), MemOperand(MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID())));
           break;
           case 8:
-            str(GetSrc<RA_64>(Op->Header.Args[1].ID()), MemOperand(MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID())));
+            str(GetStoreSrc<RA_64>(Op->Header.Args[1]), MemOperand(MEM_BASE, GetSrc<RA_64>(Op->Header.Args[0].ID())));
           break;
           default:  LogMan::Msg::A("Unhandled StoreMem size: %d", Op->Size);
           }
@@ -3,14 +3,19 @@
 #include "Interface/Core/BlockSamplingData.h"
 #include "Interface/Core/InternalThreadState.h"
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
+#include "Interface/Memory/HugePages.h"
 
 #include "Interface/Core/JIT/x86_64/JIT.h"
 #include <xbyak/xbyak.h>
+#include <xbyak/xbyak_util.h>
 using namespace Xbyak;
 
 #include <FEXCore/Core/CPUBackend.h>
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
+
+#include <mutex>
+#include <unordered_map>
 // #define DEBUG_RA 1
 // #define DEBUG_CYCLES
 
@@ -33,14 +38,100 @@ static void PrintValue(uint64_t Value) {
 #define TMP2 rcx
 #define TMP3 rdx
 #define TMP4 rdi
+// Holds the guest memory base when memory isn't unified, so guest accesses can use base+index addressing
+#define MEM_BASE r15
 using namespace Xbyak::util;
-const std::array<Xbyak::Reg, 10> RA64 = { rsi, r8, r9, r10, r11, rbx, rbp, r12, r13, r15 };
-const std::array<Xbyak::Reg, 10> RA32 = { esi, r8d, r9d, r10d, r11d, ebx, ebp, r12d, r13d, r15d };
-const std::array<Xbyak::Reg, 10> RA16 = { si, r8w, r9w, r10w, r11w, bx, bp, r12w, r13w, r15w };
-const std::array<Xbyak::Reg, 10> RA8 = { sil, r8b, r9b, r10b, r11b, bl, bpl, r12b, r13b, r15b };
+const std::array<Xbyak::Reg, 9> RA64 = { rsi, r8, r9, r10, r11, rbx, rbp, r12, r13 };
+const std::array<Xbyak::Reg, 9> RA32 = { esi, r8d, r9d, r10d, r11d, ebx, ebp, r12d, r13d };
+const std::array<Xbyak::Reg, 9> RA16 = { si, r8w, r9w, r10w, r11w, bx, bp, r12w, r13w };
+const std::array<Xbyak::Reg, 9> RA8 = { sil, r8b, r9b, r10b, r11b, bl, bpl, r12b, r13b };
 const std::array<Xbyak::Reg, 11> RAXMM = { xmm0, xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10 };
 const std::array<Xbyak::Xmm, 11> RAXMM_x = { xmm0, xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10 };
 
+// Sign extended 32bit immediates are the largest that ALU ops can encode
+static bool IsImm32(uint64_t Constant) {
+  return static_cast<int64_t>(Constant) == static_cast<int32_t>(Constant);
+}
+
+static bool CanInlineConstant(FEXCore::IR::IROp_Header const *IROp, uint8_t Arg, uint64_t Constant) {
+  using namespace FEXCore;
+  switch (IROp->Op) {
+  case IR::OP_ADD:
+  case IR::OP_SUB:
+  case IR::OP_AND:
+  case IR::OP_OR:
+  case IR::OP_XOR:
+  case IR::OP_SELECT:
+    return Arg == 1 && IsImm32(Constant);
+  case IR::OP_LSHL:
+  case IR::OP_LSHR:
+  case IR::OP_ASHR:
+  case IR::OP_ROL:
+  case IR::OP_ROR:
+    // Shift amounts get masked anyway
+    return Arg == 1;
+  case IR::OP_STOREMEM: {
+    auto Op = IROp->C<IR::IROp_StoreMem>();
+    return Arg == 1 && Op->Class.Val == 0 && (Op->Size < 8 || IsImm32(Constant));
+  }
+  case IR::OP_STORECONTEXT: {
+    auto Op = IROp->C<IR::IROp_StoreContext>();
+    return Arg == 0 && Op->Class.Val == 0 && (Op->Size < 8 || (Op->Size == 8 && IsImm32(Constant)));
+  }
+  default:
+    return false;
+  }
+}
+
+// SysV ABI registers that a call is allowed to clobber
+static bool IsCallerSaved(Xbyak::Reg const &Reg) {
+  switch (Reg.getIdx()) {
+  case Xbyak::Operand::RBX:
+  case Xbyak::Operand::RBP:
+  case Xbyak::Operand::R12:
+  case Xbyak::Operand::R13:
+  case Xbyak::Operand::R14:
+  case Xbyak::Operand::R15:
+    return false;
+  default:
+    return true;
+  }
+}
+
+// Hands Xbyak code buffers that are backed by huge pages, falling back to its own allocation if that fails
+class HugePageCodeAllocator final : public Xbyak::Allocator {
+public:
+  uint8_t *alloc(size_t Size) override {
+    void *Ptr = FEXCore::Memory::AllocateHugePages(Size);
+    if (!Ptr) {
+      return Xbyak::Allocator::alloc(Size);
+    }
+
+    std::scoped_lock<std::mutex> lk(AllocationMutex);
+    Allocations[Ptr] = Size;
+    return reinterpret_cast<uint8_t*>(Ptr);
+  }
+
+  void free(uint8_t *Ptr) override {
+    std::unique_lock<std::mutex> lk(AllocationMutex);
+    auto it = Allocations.find(Ptr);
+    if (it == Allocations.end()) {
+      lk.unlock();
+      Xbyak::Allocator::free(Ptr);
+      return;
+    }
+
+    FEXCore::Memory::FreeHugePages(Ptr, it->second);
+    Allocations.erase(it);
+  }
+
+private:
+  std::mutex AllocationMutex;
+  std::unordered_map<void*, size_t> Allocations;
+};
+
+static HugePageCodeAllocator HugePageAllocator;
+
 class JITCore final : public CPUBackend, public Xbyak::CodeGenerator {
 public:
   explicit JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread);
@@ -99,6 +190,34 @@ private:
   Xbyak::Xmm GetSrc(uint32_t Node);
   Xbyak::Xmm GetDst(uint32_t Node);
 
+  /**
+   * @brief Returns true if the RA left this argument as a constant for us to encode
+   * The constant's value is written to Value
+   */
+  bool IsInlineConstant(IR::OrderedNodeWrapper const &Node, uint64_t *Value);
+
+  /**
+   * @brief Emits a REP prefixed string instruction that walks in the direction the guest's direction flag asks for
+   * ZF needs to be set from testing the direction flag and the string registers need to be set up already
+   */
+  void EmitRepStringOp(uint8_t Prefix, uint8_t ByteOpcode, uint8_t Size);
+
+  /**
+   * @brief Counts the set bits in rax without popcnt, result ends up in rax
+   * Clobbers rcx and rdx
+   */
+  void EmitSoftPopcount();
+
+  /**
+   * @name Host features
+   * Instruction set extensions the host supports. Baseline lowerings get used for anything that is missing
+   * @{ */
+  bool HostSupportsBMI1{};
+  bool HostSupportsBMI2{};
+  bool HostSupportsLZCNT{};
+  bool HostSupportsPOPCNT{};
+  /**  @} */
+
   void CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread);
   bool CustomDispatchGenerated {false};
   using CustomDispatch = void(*)(FEXCore::Core::InternalThreadState *Thread);
@@ -111,16 +230,26 @@ private:
 };
 
 JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread)
-  : CodeGenerator(1024 * 1024 * 32)
+  : CodeGenerator(1024 * 1024 * 32, nullptr, ctx->Config.HugePages ? &HugePageAllocator : nullptr)
   , CTX {ctx}
   , ThreadState {Thread} {
-  Stack.resize(9000 * 16 * 64);
+  Xbyak::util::Cpu Features;
+  // Vector ops are only implemented with VEX encodings
+  LogMan::Throw::A(Features.has(Xbyak::util::Cpu::tAVX), "x86-64 JIT requires a host with AVX");
+
+  if (CTX->Config.HostFeatures) {
+    HostSupportsBMI1 = Features.has(Xbyak::util::Cpu::tBMI1);
+    HostSupportsBMI2 = Features.has(Xbyak::util::Cpu::tBMI2);
+    HostSupportsLZCNT = Features.has(Xbyak::util::Cpu::tLZCNT);
+    HostSupportsPOPCNT = Features.has(Xbyak::util::Cpu::tPOPCNT);
+  }
 
   RAPass = CTX->GetRegisterAllocatorPass();
 
   RAPass->AllocateRegisterSet(RegisterCount, RegisterClasses);
   RAPass->AddRegisters(GPRClass, NumGPRs);
   RAPass->AddRegisters(XMMClass, NumXMMs);
+  RAPass->SetInlineConstantCheck(CanInlineConstant);
   CreateCustomDispatch(Thread);
 }
 
@@ -149,6 +278,56 @@ uint32_t JITCore::GetPhys(uint32_t Node) {
   return ~0U;
 }
 
+void JITCore::EmitRepStringOp(uint8_t Prefix, uint8_t ByteOpcode, uint8_t Size) {
+  auto EmitOp = [&]() {
+    if (Size == 2)
+      db(0x66);
+    db(Prefix);
+    // REX.W needs to be directly before the opcode
+    if (Size == 8)
+      db(0x48);
+    db(Size == 1 ? ByteOpcode : ByteOpcode + 1);
+  };
+
+  Label Forward, Done;
+  jz(Forward);
+  std();
+  EmitOp();
+  // The host ABI expects the direction flag to be clear
+  cld();
+  jmp(Done);
+
+  L(Forward);
+  EmitOp();
+  L(Done);
+}
+
+void JITCore::EmitSoftPopcount() {
+  // Sum bits in pairs, nibbles, then bytes. The multiply adds every byte in to the top byte
+  mov(rcx, rax);
+  shr(rcx, 1);
+  mov(rdx, 0x5555555555555555ULL);
+  and(rcx, rdx);
+  sub(rax, rcx);
+
+  mov(rcx, rax);
+  shr(rcx, 2);
+  mov(rdx, 0x3333333333333333ULL);
+  and(rax, rdx);
+  and(rcx, rdx);
+  add(rax, rcx);
+
+  mov(rcx, rax);
+  shr(rcx, 4);
+  add(rax, rcx);
+  mov(rdx, 0x0F0F0F0F0F0F0F0FULL);
+  and(rax, rdx);
+
+  mov(rdx, 0x0101010101010101ULL);
+  imul(rax, rdx);
+  shr(rax, 56);
+}
+
 template<uint8_t RAType>
 Xbyak::Reg JITCore::GetSrc(uint32_t Node) {
   // rax, rcx, rdx, rsi, r8, r9,
@@ -193,6 +372,16 @@ Xbyak::Xmm JITCore::GetDst(uint32_t Node) {
   return RAXMM_x[Reg];
 }
 
+bool JITCore::IsInlineConstant(IR::OrderedNodeWrapper const &Node, uint64_t *Value) {
+  if (!RAPass->IsInlineConstant(Node.ID())) {
+    return false;
+  }
+
+  auto Op = Node.GetNode(CurrentIR->GetListData())->Op(CurrentIR->GetData())->C<IR::IROp_Constant>();
+  *Value = Op->Constant;
+  return true;
+}
+
 void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData) {
   JumpTargets.clear();
   CurrentIR = IR;
@@ -220,6 +409,9 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
     push(r14);
     push(r15);
     mov(STATE, rdi);
+    if (!CTX->Config.UnifiedMemory) {
+      mov(MEM_BASE, CTX->MemoryMapper.GetBaseOffset<uint64_t>(0));
+    }
   }
 
   if (SpillSlots) {
@@ -343,7 +535,10 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         for (uint8_t i = 0; i < NumArgs; ++i) {
           uint32_t ArgNode = IROp->Args[i].ID();
           uint64_t PhysReg = RAPass->GetNodeRegister(ArgNode);
-          if (PhysReg >= XMMBase)
+          uint64_t Const;
+          if (IsInlineConstant(IROp->Args[i], &Const))
+            Inst << "#0x" << std::hex << Const << std::dec << (i + 1 == NumArgs ? "" : ", ");
+          else if (PhysReg >= XMMBase)
             Inst << "XMM" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
           else
             Inst << "Reg" << GetPhys(ArgNode) << (i + 1 == NumArgs ? "" : ", ");
@@ -601,8 +796,18 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_STORECONTEXT: {
           auto Op = IROp->C<IR::IROp_StoreContext>();
+          uint64_t Const;
 
-          if (Op->Class.Val == 0) {
+          if (IsInlineConstant(Op->Header.Args[0], &Const)) {
+            switch (Op->Size) {
+            case 1: mov(byte [STATE + Op->Offset], static_cast<uint8_t>(Const)); break;
+            case 2: mov(word [STATE + Op->Offset], static_cast<uint16_t>(Const)); break;
+            case 4: mov(dword [STATE + Op->Offset], static_cast<uint32_t>(Const)); break;
+            case 8: mov(qword [STATE + Op->Offset], Const); break;
+            default:  LogMan::Msg::A("Unhandled StoreContext size: %d", Op->Size);
+            }
+          }
+          else if (Op->Class.Val == 0) {
             switch (Op->Size) {
             case 1: {
               mov(byte [STATE + Op->Offset], GetSrc<RA_8>(Op->Header.Args[0].ID()));
@@ -801,6 +1006,12 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         case IR::OP_ADD: {
           auto Op = IROp->C<IR::IROp_Add>();
           auto Dst = GetDst<RA_64>(Node);
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            add(Dst, static_cast<uint32_t>(Const));
+            break;
+          }
           mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           add(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
           mov(Dst, rax);
@@ -816,6 +1027,12 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         case IR::OP_SUB: {
           auto Op = IROp->C<IR::IROp_Sub>();
           auto Dst = GetDst<RA_64>(Node);
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            sub(Dst, static_cast<uint32_t>(Const));
+            break;
+          }
           mov(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
           sub(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           mov(Dst, rax);
@@ -824,6 +1041,12 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         case IR::OP_XOR: {
           auto Op = IROp->C<IR::IROp_Xor>();
           auto Dst = GetDst<RA_64>(Node);
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            xor(Dst, static_cast<uint32_t>(Const));
+            break;
+          }
           mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           xor(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
           mov(Dst, rax);
@@ -832,6 +1055,12 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         case IR::OP_AND: {
           auto Op = IROp->C<IR::IROp_And>();
           auto Dst = GetDst<RA_64>(Node);
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            and(Dst, static_cast<uint32_t>(Const));
+            break;
+          }
           mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
           mov(Dst, rax);
@@ -840,6 +1069,12 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         case IR::OP_OR: {
           auto Op = IROp->C<IR::IROp_Or>();
           auto Dst = GetDst<RA_64>(Node);
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            or (Dst, static_cast<uint32_t>(Const));
+            break;
+          }
           mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           or (rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
           mov(Dst, rax);
@@ -851,6 +1086,10 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           break;
         }
         case IR::OP_CONSTANT: {
+          // Every use encodes these itself
+          if (RAPass->IsInlineConstant(Node)) {
+            break;
+          }
           auto Op = IROp->C<IR::IROp_Constant>();
           mov(GetDst<RA_64>(Node), Op->Constant);
           break;
@@ -859,6 +1098,18 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Popcount>();
           auto Dst64 = GetDst<RA_64>(Node);
 
+          if (!HostSupportsPOPCNT) {
+            switch (OpSize) {
+            case 1: movzx(eax, GetSrc<RA_8>(Op->Header.Args[0].ID())); break;
+            case 2: movzx(eax, GetSrc<RA_16>(Op->Header.Args[0].ID())); break;
+            case 4: mov(eax, GetSrc<RA_32>(Op->Header.Args[0].ID())); break;
+            case 8: mov(rax, GetSrc<RA_64>(Op->Header.Args[0].ID())); break;
+            }
+            EmitSoftPopcount();
+            mov(Dst64, rax);
+            break;
+          }
+
           switch (OpSize) {
           case 1:
             movzx(GetDst<RA_32>(Node), GetSrc<RA_8>(Op->Header.Args[0].ID()));
@@ -985,10 +1236,22 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           uint8_t Mask = OpSize * 8 - 1;
 
           auto Dst = GetDst<RA_64>(Node);
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            shr(Dst, Const & Mask);
+            break;
+          }
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
 
-          shrx(Reg32e(Dst.getIdx(), 64), GetSrc<RA_64>(Op->Header.Args[0].ID()), rcx);
+          if (HostSupportsBMI2) {
+            shrx(Reg32e(Dst.getIdx(), 64), GetSrc<RA_64>(Op->Header.Args[0].ID()), rcx);
+          }
+          else {
+            mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            shr(Dst, cl);
+          }
           break;
         }
         case IR::OP_LSHL: {
@@ -996,16 +1259,55 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           uint8_t Mask = OpSize * 8 - 1;
 
           auto Dst = GetDst<RA_64>(Node);
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            shl(Dst, Const & Mask);
+            break;
+          }
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
 
-          shlx(Reg32e(Dst.getIdx(), 64), GetSrc<RA_64>(Op->Header.Args[0].ID()), rcx);
+          if (HostSupportsBMI2) {
+            shlx(Reg32e(Dst.getIdx(), 64), GetSrc<RA_64>(Op->Header.Args[0].ID()), rcx);
+          }
+          else {
+            mov(Dst, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            shl(Dst, cl);
+          }
           break;
         }
         case IR::OP_ASHR: {
           auto Op = IROp->C<IR::IROp_Ashr>();
           uint8_t Mask = OpSize * 8 - 1;
 
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            uint8_t Shift = Const & Mask;
+            switch (OpSize) {
+            case 1:
+              movsx(rax, GetSrc<RA_8>(Op->Header.Args[0].ID()));
+              sar(al, Shift);
+              movsx(GetDst<RA_64>(Node), al);
+            break;
+            case 2:
+              movsx(rax, GetSrc<RA_16>(Op->Header.Args[0].ID()));
+              sar(ax, Shift);
+              movsx(GetDst<RA_64>(Node), ax);
+            break;
+            case 4:
+              mov(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()));
+              sar(GetDst<RA_32>(Node), Shift);
+            break;
+            case 8:
+              mov(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+              sar(GetDst<RA_64>(Node), Shift);
+            break;
+            default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
+            };
+            break;
+          }
+
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
           switch (OpSize) {
@@ -1020,10 +1322,22 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
             movsx(GetDst<RA_64>(Node), ax);
           break;
           case 4:
-            sarx(Reg32e(GetDst<RA_32>(Node).getIdx(), 32), GetSrc<RA_32>(Op->Header.Args[0].ID()), ecx);
+            if (HostSupportsBMI2) {
+              sarx(Reg32e(GetDst<RA_32>(Node).getIdx(), 32), GetSrc<RA_32>(Op->Header.Args[0].ID()), ecx);
+            }
+            else {
+              mov(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()));
+              sar(GetDst<RA_32>(Node), cl);
+            }
           break;
           case 8:
-            sarx(Reg32e(GetDst<RA_64>(Node).getIdx(), 64), GetSrc<RA_64>(Op->Header.Args[0].ID()), rcx);
+            if (HostSupportsBMI2) {
+              sarx(Reg32e(GetDst<RA_64>(Node).getIdx(), 64), GetSrc<RA_64>(Op->Header.Args[0].ID()), rcx);
+            }
+            else {
+              mov(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+              sar(GetDst<RA_64>(Node), cl);
+            }
           break;
           default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
           };
@@ -1033,6 +1347,42 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Rol>();
           uint8_t Mask = OpSize * 8 - 1;
 
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            uint8_t Shift = Const & Mask;
+            switch (OpSize) {
+            case 1:
+              movzx(rax, GetSrc<RA_8>(Op->Header.Args[0].ID()));
+              rol(al, Shift);
+              mov(GetDst<RA_64>(Node), rax);
+            break;
+            case 2:
+              movzx(rax, GetSrc<RA_16>(Op->Header.Args[0].ID()));
+              rol(ax, Shift);
+              mov(GetDst<RA_64>(Node), rax);
+            break;
+            case 4:
+              if (HostSupportsBMI2) {
+                rorx(Reg32e(GetDst<RA_32>(Node).getIdx(), 32), GetSrc<RA_32>(Op->Header.Args[0].ID()), (32 - Shift) & Mask);
+              }
+              else {
+                mov(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()));
+                rol(GetDst<RA_32>(Node), Shift);
+              }
+            break;
+            case 8:
+              if (HostSupportsBMI2) {
+                rorx(Reg32e(GetDst<RA_64>(Node).getIdx(), 64), GetSrc<RA_64>(Op->Header.Args[0].ID()), (64 - Shift) & Mask);
+              }
+              else {
+                mov(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+                rol(GetDst<RA_64>(Node), Shift);
+              }
+            break;
+            }
+            break;
+          }
+
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
           switch (OpSize) {
@@ -1064,6 +1414,42 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Ror>();
           uint8_t Mask = OpSize * 8 - 1;
 
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            uint8_t Shift = Const & Mask;
+            switch (OpSize) {
+            case 1:
+              movzx(rax, GetSrc<RA_8>(Op->Header.Args[0].ID()));
+              ror(al, Shift);
+              mov(GetDst<RA_64>(Node), rax);
+            break;
+            case 2:
+              movzx(rax, GetSrc<RA_16>(Op->Header.Args[0].ID()));
+              ror(ax, Shift);
+              mov(GetDst<RA_64>(Node), rax);
+            break;
+            case 4:
+              if (HostSupportsBMI2) {
+                rorx(Reg32e(GetDst<RA_32>(Node).getIdx(), 32), GetSrc<RA_32>(Op->Header.Args[0].ID()), Shift);
+              }
+              else {
+                mov(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()));
+                ror(GetDst<RA_32>(Node), Shift);
+              }
+            break;
+            case 8:
+              if (HostSupportsBMI2) {
+                rorx(Reg32e(GetDst<RA_64>(Node).getIdx(), 64), GetSrc<RA_64>(Op->Header.Args[0].ID()), Shift);
+              }
+              else {
+                mov(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+                ror(GetDst<RA_64>(Node), Shift);
+              }
+            break;
+            }
+            break;
+          }
+
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
           switch (OpSize) {
@@ -1342,8 +1728,12 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Select>();
           auto Dst = GetDst<RA_64>(Node);
 
+          uint64_t Const;
           mov(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
-          cmp(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+          if (IsInlineConstant(Op->Header.Args[1], &Const))
+            cmp(rax, static_cast<uint32_t>(Const));
+          else
+            cmp(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
 
           switch (Op->Cond.Val) {
           case FEXCore::IR::COND_EQ:
@@ -1399,15 +1789,10 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_LOADMEM: {
           auto Op = IROp->C<IR::IROp_LoadMem>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
-          Xbyak::Reg MemReg = rax;
-          if (CTX->Config.UnifiedMemory) {
-            MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
-          }
-          else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          Xbyak::RegExp MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
+          if (!CTX->Config.UnifiedMemory) {
+            MemReg = MEM_BASE + MemReg;
           }
           if (Op->Class.Val == 0) {
             auto Dst = GetDst<RA_64>(Node);
@@ -1468,20 +1853,121 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           }
           break;
         }
+        case IR::OP_MEMSET: {
+          auto Op = IROp->C<IR::IROp_MemSet>();
+
+          // rdi holds our thread state
+          push(rdi);
+
+          mov(rdx, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+          mov(rcx, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+          if (!CTX->Config.UnifiedMemory) {
+            add(rdx, MEM_BASE);
+          }
+
+          test(GetSrc<RA_64>(Op->Header.Args[3].ID()), GetSrc<RA_64>(Op->Header.Args[3].ID()));
+          mov(rdi, rdx);
+          EmitRepStringOp(0xF3, 0xAA, Op->Size);
+
+          pop(rdi);
+          break;
+        }
+        case IR::OP_MEMCPY: {
+          auto Op = IROp->C<IR::IROp_MemCpy>();
+
+          // rdi holds our thread state and rsi is an RA register
+          push(rdi);
+          push(rsi);
+
+          mov(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          mov(rdx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+          mov(rcx, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+          if (!CTX->Config.UnifiedMemory) {
+            add(rax, MEM_BASE);
+            add(rdx, MEM_BASE);
+          }
+
+          // Direction may live in rsi, so test it before we overwrite it
+          test(GetSrc<RA_64>(Op->Header.Args[3].ID()), GetSrc<RA_64>(Op->Header.Args[3].ID()));
+          mov(rdi, rax);
+          mov(rsi, rdx);
+          EmitRepStringOp(0xF3, 0xA4, Op->Size);
+
+          pop(rsi);
+          pop(rdi);
+          break;
+        }
+        case IR::OP_MEMCMP: {
+          auto Op = IROp->C<IR::IROp_MemCmp>();
+
+          push(rdi);
+          push(rsi);
+
+          // CMPS compares [rsi] against [rdi] which matches the guest's operand order
+          mov(rdx, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+          if (!CTX->Config.UnifiedMemory) {
+            add(rax, MEM_BASE);
+            add(rdx, MEM_BASE);
+          }
+
+          test(GetSrc<RA_64>(Op->Header.Args[3].ID()), GetSrc<RA_64>(Op->Header.Args[3].ID()));
+          mov(rcx, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+          mov(rsi, rdx);
+          mov(rdi, rax);
+          // Keep the length around so we can tell how many elements were compared
+          mov(rdx, rcx);
+          EmitRepStringOp(Op->StopOnEqual ? 0xF2 : 0xF3, 0xA6, Op->Size);
+          sub(rdx, rcx);
+
+          pop(rsi);
+          pop(rdi);
+          mov(GetDst<RA_64>(Node), rdx);
+          break;
+        }
+        case IR::OP_MEMSCAN: {
+          auto Op = IROp->C<IR::IROp_MemScan>();
+
+          push(rdi);
+
+          mov(rdx, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          if (!CTX->Config.UnifiedMemory) {
+            add(rdx, MEM_BASE);
+          }
+
+          test(GetSrc<RA_64>(Op->Header.Args[3].ID()), GetSrc<RA_64>(Op->Header.Args[3].ID()));
+          mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+          mov(rcx, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+          mov(rdi, rdx);
+          // Keep the length around so we can tell how many elements were compared
+          mov(rdx, rcx);
+          EmitRepStringOp(Op->StopOnEqual ? 0xF2 : 0xF3, 0xAE, Op->Size);
+          sub(rdx, rcx);
+
+          pop(rdi);
+          mov(GetDst<RA_64>(Node), rdx);
+          break;
+        }
         case IR::OP_STOREMEM: {
           auto Op = IROp->C<IR::IROp_StoreMem>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
-          Xbyak::Reg MemReg = rax;
-          if (CTX->Config.UnifiedMemory) {
-            MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
-          }
-          else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          Xbyak::RegExp MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
+          if (!CTX->Config.UnifiedMemory) {
+            MemReg = MEM_BASE + MemReg;
           }
 
-          if (Op->Class.Val == 0) {
+          uint64_t Const;
+          if (IsInlineConstant(Op->Header.Args[1], &Const)) {
+            switch (Op->Size) {
+            case 1: mov(byte [MemReg], static_cast<uint8_t>(Const)); break;
+            case 2: mov(word [MemReg], static_cast<uint16_t>(Const)); break;
+            case 4: mov(dword [MemReg], static_cast<uint32_t>(Const)); break;
+            case 8: mov(qword [MemReg], Const); break;
+            default:  LogMan::Msg::A("Unhandled StoreMem size: %d", Op->Size);
+            }
+          }
+          else if (Op->Class.Val == 0) {
             switch (Op->Size) {
             case 1:
               mov(byte [MemReg], GetSrc<RA_8>(Op->Header.Args[1].ID()));
@@ -1523,16 +2009,36 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           }
           break;
         }
-        case IR::OP_SYSCALL: {
-          auto Op = IROp->C<IR::IROp_Syscall>();
-          // XXX: This is very terrible, but I don't care for right now
+        case IR::OP_SYSCALL:
+        case IR::OP_SYSCALLDIRECT: {
+          // Only the caller saved registers holding values that are live across the call need to be preserved
+          uint64_t LiveGPRs = RAPass->GetLiveRegisterMask(GPRClass, Node);
+          uint64_t LiveXMMs = RAPass->GetLiveRegisterMask(XMMClass, Node);
+
+          std::vector<Xbyak::Reg> SavedGPRs;
+          for (uint32_t i = 0; i < RA64.size(); ++i) {
+            if ((LiveGPRs >> i) & 1 && IsCallerSaved(RA64[i]))
+              SavedGPRs.emplace_back(RA64[i]);
+          }
+
+          std::vector<Xbyak::Xmm> SavedXMMs;
+          for (uint32_t i = 0; i < RAXMM_x.size(); ++i) {
+            if ((LiveXMMs >> i) & 1)
+              SavedXMMs.emplace_back(RAXMM_x[i]);
+          }
 
-          auto NumPush = 1 + RA64.size() + 7;
+          auto NumPush = 1 + SavedGPRs.size() + SavedXMMs.size() * 2 + 7;
           push(rdi);
 
-          for (auto &Reg : RA64)
+          for (auto &Reg : SavedGPRs)
             push(Reg);
 
+          if (!SavedXMMs.empty()) {
+            sub(rsp, SavedXMMs.size() * 16);
+            for (uint32_t i = 0; i < SavedXMMs.size(); ++i)
+              movups(xword [rsp + i * 16], SavedXMMs[i]);
+          }
+
           // Syscall ABI for x86-64
           // this: rdi
           // Thread: rsi
@@ -1542,19 +2048,25 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
           // These are pushed in reverse order because stacks
           for (uint32_t i = 7; i > 0; --i)
-            push(GetSrc<RA_64>(Op->Header.Args[i - 1].ID()));
+            push(GetSrc<RA_64>(IROp->Args[i - 1].ID()));
 
           mov(rsi, rdi); // Move thread in to rsi
           mov(rdi, reinterpret_cast<uint64_t>(&CTX->SyscallHandler));
           mov(rdx, rsp);
 
-          using PtrType = uint64_t (FEXCore::SyscallHandler::*)(FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args);
-          union {
-            PtrType ptr;
-            uint64_t Raw;
-          } PtrCast;
-          PtrCast.ptr = &FEXCore::SyscallHandler::HandleSyscall;
-          mov(rax, PtrCast.Raw);
+          if (IROp->Op == IR::OP_SYSCALLDIRECT) {
+            auto Op = IROp->C<IR::IROp_SyscallDirect>();
+            mov(rax, reinterpret_cast<uint64_t>(FEXCore::SyscallHandler::GetDirectHandler(Op->Syscall)));
+          }
+          else {
+            using PtrType = uint64_t (FEXCore::SyscallHandler::*)(FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args);
+            union {
+              PtrType ptr;
+              uint64_t Raw;
+            } PtrCast;
+            PtrCast.ptr = &FEXCore::SyscallHandler::HandleSyscall;
+            mov(rax, PtrCast.Raw);
+          }
 
           if (!(NumPush & 1))
             sub(rsp, 8); // Align
@@ -1564,12 +2076,17 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           if (!(NumPush & 1))
             add(rsp, 8); // Align
 
-          // Reload arguments just in case they are sill live after the fact
-          for (uint32_t i = 0; i < 7; ++i)
-            pop(GetSrc<RA_64>(Op->Header.Args[i].ID()));
+          // Drop the arguments, anything still live after the call was saved above
+          add(rsp, 7 * 8);
 
-          for (uint32_t i = RA64.size(); i > 0; --i)
-            pop(RA64[i - 1]);
+          if (!SavedXMMs.empty()) {
+            for (uint32_t i = 0; i < SavedXMMs.size(); ++i)
+              movups(SavedXMMs[i], xword [rsp + i * 16]);
+            add(rsp, SavedXMMs.size() * 16);
+          }
+
+          for (uint32_t i = SavedGPRs.size(); i > 0; --i)
+            pop(SavedGPRs[i - 1]);
 
           pop(rdi);
 
@@ -1636,22 +2153,27 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         case IR::OP_PRINT: {
           auto Op = IROp->C<IR::IROp_Print>();
 
-          push(rdi);
           push(rdi);
 
           for (auto &Reg : RA64)
             push(Reg);
 
+          auto NumPush = RA64.size() + 1;
+          if (!(NumPush & 1))
+            sub(rsp, 8); // Align
+
           mov (rdi, GetSrc<RA_64>(Op->Header.Args[0].ID()));
 
           mov(rax, reinterpret_cast<uintptr_t>(PrintValue));
           call(rax);
 
+          if (!(NumPush & 1))
+            add(rsp, 8); // Align
+
           for (uint32_t i = RA64.size(); i > 0; --i)
             pop(RA64[i - 1]);
 
           pop(rdi);
-          pop(rdi);
 
           break;
         }
@@ -2628,15 +3150,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           // This will write to memory! Careful!
           // Third operand must be a calculated guest memory address
           //OrderedNode *CASResult = _CAS(Src3, Src2, Src1);
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           Xbyak::Reg MemReg = rcx;
           if (CTX->Config.UnifiedMemory) {
             MemReg = GetSrc<RA_64>(Op->Header.Args[2].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[2].ID())]);
           }
 
           mov(rdx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
@@ -2676,15 +3196,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICADD: {
           auto Op = IROp->C<IR::IROp_AtomicAdd>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           Xbyak::Reg MemReg = rax;
           if (CTX->Config.UnifiedMemory) {
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
 
           lock();
@@ -2708,15 +3226,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICSUB: {
           auto Op = IROp->C<IR::IROp_AtomicSub>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           Xbyak::Reg MemReg = rax;
           if (CTX->Config.UnifiedMemory) {
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
           lock();
           switch (Op->Size) {
@@ -2739,15 +3255,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICAND: {
           auto Op = IROp->C<IR::IROp_AtomicAnd>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           Xbyak::Reg MemReg = rax;
           if (CTX->Config.UnifiedMemory) {
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
           lock();
           switch (Op->Size) {
@@ -2770,15 +3284,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICOR: {
           auto Op = IROp->C<IR::IROp_AtomicOr>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           Xbyak::Reg MemReg = rax;
           if (CTX->Config.UnifiedMemory) {
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
           lock();
           switch (Op->Size) {
@@ -2801,15 +3313,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICXOR: {
           auto Op = IROp->C<IR::IROp_AtomicXor>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           Xbyak::Reg MemReg = rax;
           if (CTX->Config.UnifiedMemory) {
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
           lock();
           switch (Op->Size) {
@@ -2832,15 +3342,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICSWAP: {
           auto Op = IROp->C<IR::IROp_AtomicSwap>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           Xbyak::Reg MemReg = rax;
           if (CTX->Config.UnifiedMemory) {
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
           lock();
           switch (Op->Size) {
@@ -2867,15 +3375,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICFETCHADD: {
           auto Op = IROp->C<IR::IROp_AtomicFetchAdd>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           Xbyak::Reg MemReg = rax;
           if (CTX->Config.UnifiedMemory) {
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
           switch (Op->Size) {
           case 1:
@@ -2909,15 +3415,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICFETCHSUB: {
           auto Op = IROp->C<IR::IROp_AtomicFetchSub>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           Xbyak::Reg MemReg = rax;
           if (CTX->Config.UnifiedMemory) {
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
           switch (Op->Size) {
           case 1:
@@ -2954,7 +3458,6 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICFETCHAND: {
           auto Op = IROp->C<IR::IROp_AtomicFetchAnd>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           // TMP1 = rax
           Xbyak::Reg MemReg = TMP4;
@@ -2962,8 +3465,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
 
           switch (Op->Size) {
@@ -3040,7 +3542,6 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICFETCHOR: {
           auto Op = IROp->C<IR::IROp_AtomicFetchOr>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           // TMP1 = rax
           Xbyak::Reg MemReg = TMP4;
@@ -3048,8 +3549,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
           switch (Op->Size) {
             case 1: {
@@ -3125,7 +3625,6 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_ATOMICFETCHXOR: {
           auto Op = IROp->C<IR::IROp_AtomicFetchXor>();
-          uint64_t Memory = CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
 
           // TMP1 = rax
           Xbyak::Reg MemReg = TMP4;
@@ -3133,8 +3632,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
             MemReg = GetSrc<RA_64>(Op->Header.Args[0].ID());
           }
           else {
-            mov(MemReg, Memory);
-            add(MemReg, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            lea(MemReg, ptr [MEM_BASE + GetSrc<RA_64>(Op->Header.Args[0].ID())]);
           }
           switch (Op->Size) {
             case 1: {
@@ -3221,7 +3719,11 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_FINDLSB: {
           auto Op = IROp->C<IR::IROp_FindLSB>();
-          tzcnt(rcx, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          // Zero sources get masked to -1 below, so bsf's undefined result doesn't matter
+          if (HostSupportsBMI1)
+            tzcnt(rcx, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          else
+            bsf(rcx, GetSrc<RA_64>(Op->Header.Args[0].ID()));
           xor(rax, rax);
           cmp(GetSrc<RA_64>(Op->Header.Args[0].ID()), 1);
           sbb(rax, rax);
@@ -3231,6 +3733,29 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_FINDMSB: {
           auto Op = IROp->C<IR::IROp_FindMSB>();
+          if (HostSupportsLZCNT) {
+            // MSB is the highest bit index minus the leading zeros
+            uint8_t HighBit = 63;
+            switch (OpSize) {
+            case 2:
+              movzx(eax, GetSrc<RA_16>(Op->Header.Args[0].ID()));
+              lzcnt(eax, eax);
+              HighBit = 31;
+              break;
+            case 4:
+              lzcnt(eax, GetSrc<RA_32>(Op->Header.Args[0].ID()));
+              HighBit = 31;
+              break;
+            case 8:
+              lzcnt(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+              break;
+            default: LogMan::Msg::A("Unknown OpSize: %d", OpSize);
+            }
+            mov(GetDst<RA_64>(Node), HighBit);
+            sub(GetDst<RA_64>(Node), rax);
+            break;
+          }
+
           switch (OpSize) {
           case 2:
             bsr(GetDst<RA_16>(Node), GetSrc<RA_16>(Op->Header.Args[0].ID()));
@@ -3266,7 +3791,15 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_FINDTRAILINGZEROS: {
           auto Op = IROp->C<IR::IROp_FindTrailingZeros>();
-          tzcnt(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          if (HostSupportsBMI1) {
+            tzcnt(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          }
+          else {
+            // bsf leaves the destination undefined for zero, tzcnt returns the operand size
+            mov(eax, 64);
+            bsf(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+            cmovz(GetDst<RA_64>(Node), rax);
+          }
           break;
         }
         case IR::OP_DUMMY:
@@ -3342,6 +3875,11 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
 
   mov(STATE, rdi);
 
+  // Blocks called from the dispatcher don't set up MEM_BASE themselves
+  if (!CTX->Config.UnifiedMemory) {
+    mov(MEM_BASE, CTX->MemoryMapper.GetBaseOffset<uint64_t>(0));
+  }
+
   Label LoopTop;
   L(LoopTop);
 
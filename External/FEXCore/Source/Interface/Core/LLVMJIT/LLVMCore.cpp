@@ -1,12 +1,18 @@
+#include "Common/Paths.h"
 #include "Interface/Context/Context.h"
+#include "Interface/Core/BulkMemory.h"
 #include "Interface/Core/DebugData.h"
 #include "Interface/Core/LLVMJIT/LLVMMemoryManager.h"
+#include "Interface/Core/LLVMJIT/LLVMObjectCache.h"
 #include "Interface/HLE/Syscalls.h"
 
 #include <FEXCore/Core/CPUBackend.h>
 
-#include <llvm-c/Core.h>
-#include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/RTDyldObjectLinkingLayer.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
 #include <llvm/InitializePasses.h>
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/IRPrintingPasses.h>
@@ -19,6 +25,10 @@
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
 #include <llvm/Transforms/Scalar.h>
 #include <llvm/Transforms/Vectorize.h>
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #define DESTMAP_AS_MAP 1
@@ -30,6 +40,12 @@ using DestMapType = std::vector<llvm::Value*>;
 
 namespace FEXCore::CPU {
 
+#if LLVM_VERSION_MAJOR >= 14
+using OptimizationLevel = llvm::OptimizationLevel;
+#else
+using OptimizationLevel = llvm::PassBuilder::OptimizationLevel;
+#endif
+
 static void CPUIDRun_Thunk(CPUIDEmu::FunctionResults *Results, FEXCore::CPUIDEmu *Class, uint32_t Function) {
   *Results = Class->RunFunction(Function);
 }
@@ -44,6 +60,8 @@ public:
   ~LLVMJITCore() override;
   std::string GetName() override { return "JIT"; }
   void* CompileCode(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData) override ;
+  bool HasBatchCompile() const override { return true; }
+  void CompileCodeBatch(std::vector<BatchBlock> &Blocks) override;
 
   void *MapRegion(void *HostPtr, uint64_t GuestPtr, uint64_t Size) override {
     return HostPtr;
@@ -51,7 +69,19 @@ public:
 
   bool NeedsOpDispatch() override { return true; }
 
+  void InvalidateGuestCodeRange(uint64_t Address, uint64_t Size) override;
+
 private:
+  // Maximum number of blocks that go in to a single module when batching
+  constexpr static size_t MAX_BATCH_BLOCKS = 256;
+
+  llvm::Function *CreateBlockFunction(uint64_t Entry, llvm::Module *Module);
+  void EmitBlockFunction(FEXCore::IR::IRListView<true> const *IR, llvm::Function *BlockFunction);
+  void CompileBatch(BatchBlock *Blocks, size_t Count);
+  void ReleaseBlock(uint64_t Entry);
+  void FreeReleasedCode();
+  bool GetEntryRIPOffset(llvm::Value *Value, uint64_t *Offset);
+  void AddModuleKey(std::string *Key, FEXCore::IR::IRListView<true> const *IR);
   void HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrapperIterator *Node);
   llvm::Value *CreateContextGEP(uint64_t Offset, uint8_t Size);
   llvm::Value *CreateContextPtr(uint64_t Offset, uint8_t Size);
@@ -71,12 +101,53 @@ private:
   FEXCore::Context::Context *CTX;
 
   struct LLVMState {
-    LLVMContextRef ContextRef;
-    llvm::Module *MainModule;
-    llvm::EngineBuilder *MainEngineBuilder;
+    llvm::orc::ThreadSafeContext Context;
+    std::unique_ptr<llvm::orc::LLJIT> JIT;
     llvm::IRBuilder<> *IRBuilder;
-    LLVMMemoryManager *MemManager;
-    std::vector<llvm::ExecutionEngine*> Functions;
+
+    // Resource tracker of each block's module, keyed by guest RIP
+    // Removing a tracker frees the block's code
+    std::unordered_map<uint64_t, llvm::orc::ResourceTrackerSP> Trackers;
+
+    // Host functions and data that JIT code references, defined in the main JITDylib before the module that needs them is added
+    // Code only references the host through these so that cached objects can be relocated in to any process
+    llvm::orc::SymbolMap HostSymbols;
+    std::unordered_set<std::string> DefinedHostSymbols;
+
+    // Batched blocks live in their own JITDylib so later recompiles of a block don't clash with their symbols
+    // The JITDylib is cleared once every block in it has been released
+    struct Batch {
+      llvm::orc::JITDylib *Dylib;
+      size_t LiveBlocks;
+    };
+    struct BatchBlock {
+      Batch *Owner;
+      // Other blocks in the batch chain in to this block through this pointer
+      // Clearing it sends them back to the dispatcher instead of in to code that is getting released
+      void **Link;
+    };
+    std::vector<std::unique_ptr<Batch>> Batches;
+    std::unordered_map<uint64_t, BatchBlock> BatchBlocks;
+
+    // Functions and their chain links in the batch currently being built, keyed by guest RIP
+    std::unordered_map<uint64_t, llvm::Function*> BatchFunctions;
+    std::unordered_map<uint64_t, llvm::GlobalVariable*> BatchLinks;
+
+    // Guest code can get invalidated from inside a block, the code is freed the next time we compile instead
+    std::vector<llvm::orc::ResourceTrackerSP> ReleasedTrackers;
+    std::vector<llvm::orc::JITDylib*> ReleasedDylibs;
+
+    size_t LastCodeSize;
+  };
+
+  // Optimization pipeline, built once and reused for every module
+  struct LLVMPasses {
+    std::unique_ptr<llvm::PassBuilder> Builder;
+    llvm::LoopAnalysisManager LAM;
+    llvm::FunctionAnalysisManager FAM;
+    llvm::CGSCCAnalysisManager CGAM;
+    llvm::ModuleAnalysisManager MAM;
+    llvm::ModulePassManager MPM;
   };
 
   struct LLVMCurrentState {
@@ -102,14 +173,25 @@ private:
 
     llvm::Type *CPUStateType;
     llvm::GlobalVariable *CPUStateVar;
-    llvm::LoadInst *CPUState;
+    llvm::Value *CPUState;
 
     llvm::BasicBlock *CurrentBlock;
     std::vector<llvm::BasicBlock*> Blocks;
     llvm::BasicBlock *ExitBlock;
+
+    // RIP the function was entered at, and the value the IR loads it in to
+    uint64_t Entry;
+    llvm::Value *EntryRIP;
+
+    // Guest RIP that the current block leaves with, if it is known at compile time
+    // Only known for the function's own entry, code shared with other RIPs checks the stored RIP before chaining
+    bool ExitRIPKnown;
+    uint64_t ExitRIP;
   };
 
+  LLVMObjectCache Cache;
   LLVMState JITState;
+  LLVMPasses Passes;
   LLVMCurrentState JITCurrentState;
   llvm::LLVMContext *Con;
   llvm::Function *Func;
@@ -183,7 +265,7 @@ private:
 
   void CreateDebugPrint(llvm::Value *Val) {
     std::vector<llvm::Value*> Args;
-    Args.emplace_back(JITState.IRBuilder->getInt64(reinterpret_cast<uint64_t>(this)));
+    Args.emplace_back(GetHostPointer("LLVMJITCore", this));
     Args.emplace_back(Val);
     if (Val->getType()->getIntegerBitWidth() > 64)
       JITState.IRBuilder->CreateCall(JITCurrentState.DebugPrint128, Args);
@@ -191,7 +273,13 @@ private:
       JITState.IRBuilder->CreateCall(JITCurrentState.DebugPrint, Args);
   }
 
-  void CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Module *FunctionModule);
+  void CreateGlobalVariables(llvm::Module *FunctionModule);
+  void AddHostSymbol(llvm::StringRef Name, void const *Ptr);
+  void AddHostSymbol(llvm::Function *Func, void *Ptr) { AddHostSymbol(Func->getName(), Ptr); }
+  void DefineHostSymbols();
+  llvm::GlobalVariable *GetHostData(llvm::StringRef Name, void const *Ptr);
+  llvm::Value *GetHostPointer(llvm::StringRef Name, void const *Ptr);
+  void OptimizeModule(llvm::Module &Module);
 
   llvm::Value *CastVectorToType(llvm::Value *Arg, bool Integer, uint8_t RegisterSize, uint8_t ElementSize);
   llvm::Value *CastToOpaqueStructure(llvm::Value *Arg, llvm::Type *DstType);
@@ -205,51 +293,161 @@ private:
 
   // Target Machines
 #ifdef _M_X86_64
-  const std::string arch = "x86-64";
   const std::string cpu = "skylake";
   const llvm::Triple TargetTriple{"x86_64", "unknown", "linux", "gnu"};
 #else
-  const std::string arch = "aarch64";
   const std::string cpu = "cortex-a76";
   const llvm::Triple TargetTriple{"aarch64", "unknown", "linux", "gnu"};
 #endif
   const llvm::SmallVector<std::string, 0> Attrs;
-  llvm::TargetMachine *LLVMTarget;
+  std::unique_ptr<llvm::TargetMachine> LLVMTarget;
+
+  // Everything outside of the IR that changes the generated code, part of every module's cache key
+  std::string BackendOptions;
 };
 
 LLVMJITCore::LLVMJITCore(FEXCore::Core::InternalThreadState *Thread)
   : ThreadState {Thread}
-  , CTX {Thread->CTX} {
+  , CTX {Thread->CTX}
+  , Cache {FEXCore::Paths::GetDataPath() + "/LLVMCache/"} {
 
   llvm::InitializeNativeTarget();
   llvm::InitializeNativeTargetAsmPrinter();
 
-  JITState.ContextRef = LLVMContextCreate();
-  Con = *llvm::unwrap(&JITState.ContextRef);
-  JITState.MainModule = new llvm::Module("Main Module", *Con);
+  JITState.Context = llvm::orc::ThreadSafeContext(std::make_unique<llvm::LLVMContext>());
+  Con = JITState.Context.getContext();
   JITState.IRBuilder = new llvm::IRBuilder<>(*Con);
-  JITState.MainEngineBuilder = new llvm::EngineBuilder(std::unique_ptr<llvm::Module>(JITState.MainModule));
-  JITState.MainEngineBuilder->setEngineKind(llvm::EngineKind::JIT);
-  LLVMTarget = JITState.MainEngineBuilder->selectTarget(
-      TargetTriple,
-      arch, cpu, Attrs);
+  JITState.LastCodeSize = 0;
+
+  llvm::orc::JITTargetMachineBuilder TargetBuilder(TargetTriple);
+  TargetBuilder.setCPU(cpu);
+  TargetBuilder.addFeatures(std::vector<std::string>(Attrs.begin(), Attrs.end()));
+  TargetBuilder.setCodeGenOptLevel(llvm::CodeGenOpt::Aggressive);
+
+  // The optimization pipeline gets its own target machine, LLJIT keeps one around for codegen
+  auto Target = TargetBuilder.createTargetMachine();
+  if (!Target) {
+    LogMan::Msg::A("Couldn't create LLVM target machine: %s", llvm::toString(Target.takeError()).c_str());
+    return;
+  }
+  LLVMTarget = std::move(*Target);
+
+  // No compile threads means LLJIT compiles on this thread and reuses a single target machine
+  auto JIT = llvm::orc::LLJITBuilder()
+    .setJITTargetMachineBuilder(std::move(TargetBuilder))
+    .setCompileFunctionCreator([this](llvm::orc::JITTargetMachineBuilder Builder) -> llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> {
+      auto Target = Builder.createTargetMachine();
+      if (!Target) {
+        return Target.takeError();
+      }
+      return std::make_unique<llvm::orc::TMOwningSimpleCompiler>(std::move(*Target), &Cache);
+    })
+    .setObjectLinkingLayerCreator([this](llvm::orc::ExecutionSession &ES, llvm::Triple const &) {
+      return std::make_unique<llvm::orc::RTDyldObjectLinkingLayer>(ES, [this]() {
+        return std::make_unique<LLVMMemoryManager>(&JITState.LastCodeSize);
+      });
+    })
+    .create();
+
+  if (!JIT) {
+    LogMan::Msg::A("Couldn't create LLJIT: %s", llvm::toString(JIT.takeError()).c_str());
+    return;
+  }
+  JITState.JIT = std::move(*JIT);
+
+  Passes.Builder = std::make_unique<llvm::PassBuilder>(LLVMTarget.get());
+  Passes.Builder->registerLoopAnalyses(Passes.LAM);
+  Passes.Builder->registerFunctionAnalyses(Passes.FAM);
+  Passes.Builder->registerCGSCCAnalyses(Passes.CGAM);
+  Passes.Builder->registerModuleAnalyses(Passes.MAM);
+  Passes.Builder->crossRegisterProxies(Passes.LAM, Passes.FAM, Passes.CGAM, Passes.MAM);
+
+  Passes.MPM = Passes.Builder->buildModuleOptimizationPipeline(
+    OptimizationLevel::O3);
+
+  if (CTX->Config.LLVM_PrinterPass) {
+    Passes.MPM.addPass(llvm::PrintModulePass(llvm::outs()));
+  }
+
+  // Modules get optimized when ORC materializes them
+  JITState.JIT->getIRTransformLayer().setTransform(
+    [this](llvm::orc::ThreadSafeModule TSM, llvm::orc::MaterializationResponsibility const &) -> llvm::Expected<llvm::orc::ThreadSafeModule> {
+      TSM.withModuleDo([this](llvm::Module &Module) {
+        // Cached modules never get compiled, don't spend time optimizing them
+        if (!Cache.HasObject(&Module)) {
+          OptimizeModule(Module);
+        }
+      });
+      return std::move(TSM);
+    });
 
-  JITState.MemManager = new LLVMMemoryManager();
   CTX->Config.LLVM_MemoryValidation = false;
+
+  BackendOptions = TargetTriple.str() + ":" + cpu + ":" LLVM_VERSION_STRING;
+  for (auto const &Attr : Attrs) {
+    BackendOptions += ":" + Attr;
+  }
+  BackendOptions += CTX->Config.LLVM_MemoryValidation ? ":Validate" : "";
+
 #if !DESTMAP_AS_MAP
   DestMap.resize(0x1000);
 #endif
 }
 
 LLVMJITCore::~LLVMJITCore() {
-  // MainEngineBuilder takes overship of MainModule
-  delete JITState.MainEngineBuilder;
+  // Tearing down the JIT releases the code of every block that is still alive
+  JITState.Trackers.clear();
+  JITState.ReleasedTrackers.clear();
+  JITState.JIT.reset();
   delete JITState.IRBuilder;
-  // Causes fault when destroying MCJIT
-  //for (auto Module : JITState.Functions) {
-  //  delete Module;
-  //}
-  LLVMContextDispose(JITState.ContextRef);
+}
+
+void LLVMJITCore::OptimizeModule(llvm::Module &Module) {
+  if (CTX->Config.LLVM_IRValidation) {
+    verifyModule(Module, &llvm::outs());
+  }
+
+  Passes.MPM.run(Module, Passes.MAM);
+
+  // Cached analysis results refer to this module, don't let them leak in to the next one
+  Passes.LAM.clear();
+  Passes.FAM.clear();
+  Passes.CGAM.clear();
+  Passes.MAM.clear();
+}
+
+void LLVMJITCore::AddHostSymbol(llvm::StringRef Name, void const *Ptr) {
+  // Every module declares these but they only need to be defined in the JITDylib once
+  if (!JITState.DefinedHostSymbols.insert(Name.str()).second) {
+    return;
+  }
+
+  JITState.HostSymbols[JITState.JIT->mangleAndIntern(Name)] =
+    llvm::JITEvaluatedSymbol(llvm::pointerToJITTargetAddress(Ptr), llvm::JITSymbolFlags::Exported);
+}
+
+void LLVMJITCore::DefineHostSymbols() {
+  if (JITState.HostSymbols.empty()) {
+    return;
+  }
+
+  llvm::cantFail(JITState.JIT->getMainJITDylib().define(llvm::orc::absoluteSymbols(std::move(JITState.HostSymbols))));
+  JITState.HostSymbols.clear();
+}
+
+llvm::GlobalVariable *LLVMJITCore::GetHostData(llvm::StringRef Name, void const *Ptr) {
+  auto Module = Func->getParent();
+  auto Global = Module->getNamedGlobal(Name);
+  if (!Global) {
+    Global = new llvm::GlobalVariable(*Module, llvm::Type::getInt8Ty(*Con), false, llvm::GlobalValue::ExternalLinkage, nullptr, Name);
+  }
+
+  AddHostSymbol(Name, Ptr);
+  return Global;
+}
+
+llvm::Value *LLVMJITCore::GetHostPointer(llvm::StringRef Name, void const *Ptr) {
+  return JITState.IRBuilder->CreatePtrToInt(GetHostData(Name, Ptr), llvm::Type::getInt64Ty(*Con));
 }
 
 void LLVMJITCore::ValidateMemoryInVM(uint64_t Ptr, uint8_t Size, bool Load) {
@@ -293,7 +491,7 @@ void LLVMJITCore::MemoryStore_Validate(uint64_t Ptr, Type Val) {
 llvm::Value *LLVMJITCore::CreateMemoryLoad(llvm::Value *Ptr, uint8_t Align) {
   if (CTX->Config.LLVM_MemoryValidation) {
     std::vector<llvm::Value*> Args;
-    Args.emplace_back(JITState.IRBuilder->getInt64(reinterpret_cast<uint64_t>(this)));
+    Args.emplace_back(GetHostPointer("LLVMJITCore", this));
     Args.emplace_back(Ptr);
 
     unsigned PtrSize = Ptr->getType()->getPointerElementType()->getIntegerBitWidth();
@@ -307,13 +505,13 @@ llvm::Value *LLVMJITCore::CreateMemoryLoad(llvm::Value *Ptr, uint8_t Align) {
     }
   }
 
-  return JITState.IRBuilder->CreateAlignedLoad(Ptr, Align);
+  return JITState.IRBuilder->CreateAlignedLoad(Ptr->getType()->getPointerElementType(), Ptr, llvm::MaybeAlign(Align));
 }
 
 void LLVMJITCore::CreateMemoryStore(llvm::Value *Ptr, llvm::Value *Val, uint8_t Align) {
   if (CTX->Config.LLVM_MemoryValidation) {
     std::vector<llvm::Value*> Args;
-    Args.emplace_back(JITState.IRBuilder->getInt64(reinterpret_cast<uint64_t>(this)));
+    Args.emplace_back(GetHostPointer("LLVMJITCore", this));
     Args.emplace_back(Ptr);
     Args.emplace_back(Val);
 
@@ -329,11 +527,11 @@ void LLVMJITCore::CreateMemoryStore(llvm::Value *Ptr, llvm::Value *Val, uint8_t
     return;
   }
 
-  JITState.IRBuilder->CreateAlignedStore(Val, Ptr, Align);
+  JITState.IRBuilder->CreateAlignedStore(Val, Ptr, llvm::MaybeAlign(Align));
 }
 
 
-void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Module *FunctionModule) {
+void LLVMJITCore::CreateGlobalVariables(llvm::Module *FunctionModule) {
   using namespace llvm;
   Type *voidTy = Type::getVoidTy(*Con);
   Type *i8 = Type::getInt8Ty(*Con);
@@ -362,7 +560,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
     };
     PtrCast Ptr;
     Ptr.ClassPtr = &FEXCore::SyscallHandler::HandleSyscall;
-    Engine->addGlobalMapping(JITCurrentState.SyscallFunction, Ptr.Data);
+    AddHostSymbol(JITCurrentState.SyscallFunction, Ptr.Data);
   }
 
   // CPUID Function
@@ -385,7 +583,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
     };
     PtrCast Ptr;
     Ptr.ClassPtr = &CPUIDRun_Thunk;
-    Engine->addGlobalMapping(JITCurrentState.CPUIDFunction, Ptr.Data);
+    AddHostSymbol(JITCurrentState.CPUIDFunction, Ptr.Data);
   }
 
   // Exit VM function
@@ -406,7 +604,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
     };
     PtrCast Ptr;
     Ptr.ClassPtr = &SetExitState_Thunk;
-    Engine->addGlobalMapping(JITCurrentState.ExitVMFunction, Ptr.Data);
+    AddHostSymbol(JITCurrentState.ExitVMFunction, Ptr.Data);
   }
 
   if (CTX->Config.LLVM_MemoryValidation) {
@@ -426,7 +624,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryLoad_Validate<uint8_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateLoad8, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateLoad8, Ptr.Data);
     }
     // Memory validate load 16
     {
@@ -444,7 +642,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryLoad_Validate<uint16_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateLoad16, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateLoad16, Ptr.Data);
     }
     // Memory validate load 32
     {
@@ -463,7 +661,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryLoad_Validate<uint32_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateLoad32, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateLoad32, Ptr.Data);
     }
     // Memory validate load 64
     {
@@ -481,7 +679,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryLoad_Validate<uint64_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateLoad64, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateLoad64, Ptr.Data);
     }
     // Memory validate load 128
     {
@@ -499,7 +697,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryLoad_Validate<__uint128_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateLoad128, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateLoad128, Ptr.Data);
     }
 
     // Memory validate Store 8
@@ -519,7 +717,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryStore_Validate<uint8_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateStore8, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateStore8, Ptr.Data);
     }
 
     // Memory validate Store 16
@@ -539,7 +737,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryStore_Validate<uint16_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateStore16, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateStore16, Ptr.Data);
     }
 
     // Memory validate Store 32
@@ -559,7 +757,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryStore_Validate<uint32_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateStore32, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateStore32, Ptr.Data);
     }
 
     // Memory validate Store 64
@@ -579,7 +777,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryStore_Validate<uint64_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateStore64, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateStore64, Ptr.Data);
     }
 
     // Memory validate Store 128
@@ -599,7 +797,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       };
       PtrCast Ptr;
       Ptr.ClassPtr = &LLVMJITCore::MemoryStore_Validate<__uint128_t>;
-      Engine->addGlobalMapping(JITCurrentState.ValidateStore128, Ptr.Data);
+      AddHostSymbol(JITCurrentState.ValidateStore128, Ptr.Data);
     }
   }
 
@@ -619,7 +817,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
     };
     PtrCast Ptr;
     Ptr.ClassPtr = &LLVMJITCore::DebugPrint;
-    Engine->addGlobalMapping(JITCurrentState.DebugPrint, Ptr.Data);
+    AddHostSymbol(JITCurrentState.DebugPrint, Ptr.Data);
   }
 
   // Value Print 128
@@ -638,7 +836,7 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
     };
     PtrCast Ptr;
     Ptr.ClassPtr = &LLVMJITCore::DebugPrint128;
-    Engine->addGlobalMapping(JITCurrentState.DebugPrint128, Ptr.Data);
+    AddHostSymbol(JITCurrentState.DebugPrint128, Ptr.Data);
   }
 
   // JIT State
@@ -655,14 +853,11 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
       },
       "CPUStateType");
 
-    FunctionModule->getOrInsertGlobal("X86State::State", JITCurrentState.CPUStateType->getPointerTo());
-    JITCurrentState.CPUStateVar = FunctionModule->getNamedGlobal("X86State::State");
-    JITCurrentState.CPUStateVar->setConstant(true);
-    JITCurrentState.CPUStateVar->setInitializer(
-      ConstantInt::getIntegerValue(
-        JITCurrentState.CPUStateType->getPointerTo(),
-        APInt(64, reinterpret_cast<uint64_t>(&ThreadState->State))));
-    JITCurrentState.CPUState = JITState.IRBuilder->CreateLoad(JITCurrentState.CPUStateVar, false, "X86State::State::Local");
+    // Resolves to this thread's state when the module is linked
+    JITCurrentState.CPUStateVar = new GlobalVariable(*FunctionModule, JITCurrentState.CPUStateType, false,
+      GlobalValue::ExternalLinkage, nullptr, "X86State::State");
+    JITCurrentState.CPUState = JITCurrentState.CPUStateVar;
+    AddHostSymbol(JITCurrentState.CPUStateVar->getName(), &ThreadState->State);
   }
 }
 
@@ -701,7 +896,7 @@ llvm::Value *LLVMJITCore::CreateContextGEP(uint64_t Offset, uint8_t Size) {
   else
     LogMan::Msg::A("Unknown X86State GEP: 0x%lx", Offset);
 
-  return JITState.IRBuilder->CreateGEP(JITCurrentState.CPUState, GEPValues, "Context::Value");
+  return JITState.IRBuilder->CreateGEP(JITCurrentState.CPUStateType, JITCurrentState.CPUState, GEPValues, "Context::Value");
 }
 
 llvm::Value *LLVMJITCore::CreateContextPtr(uint64_t Offset, uint8_t Size) {
@@ -746,7 +941,7 @@ llvm::Value *LLVMJITCore::CastVectorToType(llvm::Value *Arg, bool Integer, uint8
     }
   }
 
-  llvm::Type *VectorType = llvm::VectorType::get(ElementType, NumElements);
+  llvm::Type *VectorType = llvm::FixedVectorType::get(ElementType, NumElements);
 
   // This happens frequently
   // If the source argument isn't of vector type then BitCast fails moving from Scalar->Vector domains
@@ -761,8 +956,9 @@ llvm::Value *LLVMJITCore::CastVectorToType(llvm::Value *Arg, bool Integer, uint8
 llvm::Value *LLVMJITCore::CastToOpaqueStructure(llvm::Value *Arg, llvm::Type *DstType) {
   if (Arg->getType()->isVectorTy()) {
     // First do a bitcast from the vector type to the same size integer
-    unsigned ElementSize = Arg->getType()->getVectorElementType()->getIntegerBitWidth();
-    unsigned NumElements = Arg->getType()->getVectorNumElements();
+    auto ArgVectorType = llvm::cast<llvm::FixedVectorType>(Arg->getType());
+    unsigned ElementSize = ArgVectorType->getElementType()->getIntegerBitWidth();
+    unsigned NumElements = ArgVectorType->getNumElements();
     auto NewIntegerType = llvm::Type::getIntNTy(*Con, ElementSize * NumElements);
     Arg = JITState.IRBuilder->CreateBitCast(Arg, NewIntegerType);
   }
@@ -795,18 +991,26 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
   FEXCore::IR::IROp_Header *IROp = RealNode->Op(DataBegin);
   uint8_t OpSize = IROp->Size;
 
+  // Anything else writing to the context behind our back could change RIP
+  if (IROp->Op != IR::OP_STORECONTEXT &&
+      IROp->Op != IR::OP_STOREFLAG &&
+      IR::GetProperties(IROp->Op).ContextWrite) {
+    JITCurrentState.ExitRIPKnown = false;
+  }
+
   switch (IROp->Op) {
     case IR::OP_ENDBLOCK: {
       auto Op = IROp->C<IR::IROp_EndBlock>();
+      JITCurrentState.ExitRIP += Op->RIPIncrement;
 
       if (Op->RIPIncrement) {
-        auto DownCountValue = JITState.IRBuilder->CreateGEP(JITCurrentState.CPUState,
+        auto DownCountValue = JITState.IRBuilder->CreateGEP(JITCurrentState.CPUStateType, JITCurrentState.CPUState,
           {
             JITState.IRBuilder->getInt32(0),
             JITState.IRBuilder->getInt32(0),
           },
           "RIPIncrement");
-        auto LoadRIP = JITState.IRBuilder->CreateLoad(DownCountValue);
+        auto LoadRIP = JITState.IRBuilder->CreateLoad(Type::getInt64Ty(*Con), DownCountValue);
         auto NewValue = JITState.IRBuilder->CreateAdd(LoadRIP, JITState.IRBuilder->getInt64(Op->RIPIncrement));
         JITState.IRBuilder->CreateStore(NewValue, DownCountValue);
       }
@@ -822,7 +1026,50 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
     break;
     }
     case IR::OP_EXITFUNCTION: {
-      JITState.IRBuilder->CreateBr(JITCurrentState.ExitBlock);
+      auto Target = JITState.BatchLinks.end();
+      if (JITCurrentState.ExitRIPKnown) {
+        Target = JITState.BatchLinks.find(JITCurrentState.ExitRIP);
+      }
+
+      if (Target == JITState.BatchLinks.end()) {
+        JITState.IRBuilder->CreateBr(JITCurrentState.ExitBlock);
+        break;
+      }
+
+      // The next block is in this module, continue straight in to it
+      // The dispatcher still needs to get control back if something asked us to stop
+      auto LoadStop = [&](llvm::StringRef Name, std::atomic_bool *Stop) {
+        return JITState.IRBuilder->CreateLoad(Type::getInt8Ty(*Con), GetHostData(Name, Stop), true);
+      };
+
+      auto Stop = JITState.IRBuilder->CreateOr(
+        JITState.IRBuilder->CreateOr(
+          LoadStop("Context::ShouldStop", &CTX->ShouldStop),
+          LoadStop("Thread::ShouldStop", &ThreadState->State.RunningEvents.ShouldStop)),
+        LoadStop("Thread::ShouldPause", &ThreadState->State.RunningEvents.ShouldPause));
+
+      // Blocks sharing this code at another RIP leave with a different RIP than the one the target was compiled for
+      auto RIP = JITState.IRBuilder->CreateLoad(Type::getInt64Ty(*Con), CreateContextPtr(offsetof(FEXCore::Core::CPUState, rip), 8));
+      auto SameTarget = JITState.IRBuilder->CreateICmpEQ(RIP, JITState.IRBuilder->getInt64(JITCurrentState.ExitRIP));
+
+      // The link is cleared once the target's code is released
+      auto Next = JITState.IRBuilder->CreateLoad(Target->second->getValueType(), Target->second);
+      auto Linked = JITState.IRBuilder->CreateICmpNE(Next, Constant::getNullValue(Next->getType()));
+
+      auto CanChain = JITState.IRBuilder->CreateAnd(
+        JITState.IRBuilder->CreateAnd(JITState.IRBuilder->CreateICmpEQ(Stop, JITState.IRBuilder->getInt8(0)), SameTarget),
+        Linked);
+      auto Chain = BasicBlock::Create(*Con, "Chain", Func);
+      JITCurrentState.Blocks.emplace_back(Chain);
+      JITState.IRBuilder->CreateCondBr(CanChain, Chain, JITCurrentState.ExitBlock);
+
+      JITState.IRBuilder->SetInsertPoint(Chain);
+      JITCurrentState.CurrentBlock = Chain;
+
+      // Same signature and calling convention so this is always a real tail call, chains of blocks don't grow the stack
+      auto Call = JITState.IRBuilder->CreateCall(Func->getFunctionType(), Next, {&*Func->arg_begin()});
+      Call->setTailCallKind(CallInst::TCK_MustTail);
+      JITState.IRBuilder->CreateRetVoid();
     break;
     }
     case IR::OP_JUMP: {
@@ -904,13 +1151,13 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       auto Op = IROp->C<IR::IROp_Syscall>();
 
       std::vector<llvm::Value*> Args;
-      Args.emplace_back(JITState.IRBuilder->getInt64(reinterpret_cast<uint64_t>(&CTX->SyscallHandler)));
+      Args.emplace_back(GetHostPointer("SyscallHandler", &CTX->SyscallHandler));
       // We need to pull this argument from the ExecuteCodeFunction
       Args.emplace_back(Func->args().begin());
 
       auto LLVMArgs = JITState.IRBuilder->CreateAlloca(ArrayType::get(Type::getInt64Ty(*Con), 7));
       for (unsigned i = 0; i < 7; ++i) {
-        auto Location = JITState.IRBuilder->CreateGEP(LLVMArgs,
+        auto Location = JITState.IRBuilder->CreateGEP(LLVMArgs->getAllocatedType(), LLVMArgs,
             {
               JITState.IRBuilder->getInt32(0),
               JITState.IRBuilder->getInt32(i),
@@ -925,6 +1172,36 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       SetDest(*WrapperOp, Result);
     break;
     }
+    case FEXCore::IR::IROps::OP_SYSCALLDIRECT: {
+      auto Op = IROp->C<IR::IROp_SyscallDirect>();
+
+      std::vector<llvm::Value*> Args;
+      Args.emplace_back(GetHostPointer("SyscallHandler", &CTX->SyscallHandler));
+      // We need to pull this argument from the ExecuteCodeFunction
+      Args.emplace_back(Func->args().begin());
+
+      auto LLVMArgs = JITState.IRBuilder->CreateAlloca(ArrayType::get(Type::getInt64Ty(*Con), 7));
+      for (unsigned i = 0; i < 7; ++i) {
+        auto Location = JITState.IRBuilder->CreateGEP(LLVMArgs->getAllocatedType(), LLVMArgs,
+            {
+              JITState.IRBuilder->getInt32(0),
+              JITState.IRBuilder->getInt32(i),
+            },
+            "Arg");
+        auto Src = GetSrc(Op->Header.Args[i]);
+        JITState.IRBuilder->CreateStore(Src, Location);
+      }
+      Args.emplace_back(LLVMArgs);
+
+      // The direct handler has the same signature as the generic handler, so just call through its pointer
+      auto FuncType = JITCurrentState.SyscallFunction->getFunctionType();
+      auto Handler = JITState.IRBuilder->CreateIntToPtr(
+        GetHostPointer("SyscallDirect_" + std::to_string(Op->Syscall), reinterpret_cast<void const*>(FEXCore::SyscallHandler::GetDirectHandler(Op->Syscall))),
+        FuncType->getPointerTo());
+      auto Result = JITState.IRBuilder->CreateCall(FuncType, Handler, Args);
+      SetDest(*WrapperOp, Result);
+    break;
+    }
     case IR::OP_CPUID: {
       auto Op = IROp->C<IR::IROp_CPUID>();
       auto Src = GetSrc(Op->Header.Args[0]);
@@ -933,7 +1210,7 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       auto ReturnType = ArrayType::get(Type::getInt32Ty(*Con), 4);
       auto LLVMArgs = JITState.IRBuilder->CreateAlloca(ReturnType);
       Args.emplace_back(LLVMArgs);
-      Args.emplace_back(JITState.IRBuilder->getInt64(reinterpret_cast<uint64_t>(&CTX->CPUID)));
+      Args.emplace_back(GetHostPointer("CPUID::Class", &CTX->CPUID));
       Args.emplace_back(Src);
       JITState.IRBuilder->CreateCall(JITCurrentState.CPUIDFunction, Args);
       auto Result = JITState.IRBuilder->CreateLoad(ReturnType, LLVMArgs);
@@ -954,9 +1231,15 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       auto Value = CreateContextPtr(Op->Offset, Op->Size);
       llvm::Value *Load;
       if ((Op->Offset % Op->Size) == 0)
-        Load = JITState.IRBuilder->CreateAlignedLoad(Value, Op->Size);
+        Load = JITState.IRBuilder->CreateAlignedLoad(Value->getType()->getPointerElementType(), Value, llvm::MaybeAlign(Op->Size));
       else
-        Load = JITState.IRBuilder->CreateLoad(Value);
+        Load = JITState.IRBuilder->CreateLoad(Value->getType()->getPointerElementType(), Value);
+
+      // The prologue loads the RIP the function was entered at before anything else touches it
+      if (!JITCurrentState.EntryRIP && Op->Offset == offsetof(FEXCore::Core::CPUState, rip) && Op->Size == 8) {
+        JITCurrentState.EntryRIP = Load;
+      }
+
       SetDest(*WrapperOp, Load);
     break;
     }
@@ -966,8 +1249,25 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       auto Value = CreateContextPtr(Op->Offset, Op->Size);
       Src = CastToOpaqueStructure(Src, Value->getType()->getPointerElementType());
 
+      if (Op->Offset < (offsetof(FEXCore::Core::CPUState, rip) + 8)) {
+        JITCurrentState.ExitRIPKnown = false;
+
+        if (Op->Offset == offsetof(FEXCore::Core::CPUState, rip) && Op->Size == 8) {
+          // Exits calculate the RIP from the entry RIP so the IR can be shared between RIPs
+          uint64_t Offset;
+          if (auto Const = dyn_cast<ConstantInt>(Src)) {
+            JITCurrentState.ExitRIPKnown = true;
+            JITCurrentState.ExitRIP = Const->getZExtValue();
+          }
+          else if (GetEntryRIPOffset(Src, &Offset)) {
+            JITCurrentState.ExitRIPKnown = true;
+            JITCurrentState.ExitRIP = JITCurrentState.Entry + Offset;
+          }
+        }
+      }
+
       if ((Op->Offset % Op->Size) == 0)
-        JITState.IRBuilder->CreateAlignedStore(Src, Value, Op->Size);
+        JITState.IRBuilder->CreateAlignedStore(Src, Value, llvm::MaybeAlign(Op->Size));
       else
         JITState.IRBuilder->CreateStore(Src, Value);
     break;
@@ -975,7 +1275,7 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
     case IR::OP_LOADFLAG: {
       auto Op = IROp->C<IR::IROp_LoadFlag>();
       auto Value = CreateContextPtr(offsetof(FEXCore::Core::CPUState, flags) + Op->Flag, 1);
-      auto Load = JITState.IRBuilder->CreateLoad(Value);
+      auto Load = JITState.IRBuilder->CreateLoad(Type::getInt8Ty(*Con), Value);
       SetDest(*WrapperOp, Load);
     break;
     }
@@ -1474,7 +1774,7 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       auto Src2 = GetSrc(Op->Header.Args[1]);
 
       // Cast to the type we want
-      Value *Undef = UndefValue::get(VectorType::get(Src1->getType(), 2));
+      Value *Undef = UndefValue::get(FixedVectorType::get(Src1->getType(), 2));
 
       // Src1 = CastToOpaqueStructure(Src1, ElementType);
       // Src2 = CastToOpaqueStructure(Src2, ElementType);
@@ -1874,14 +2174,14 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       auto Src2 = GetSrc(Op->Header.Args[1]);
       auto MemSrc = GetSrc(Op->Header.Args[2]);
 
-      MemSrc = JITState.IRBuilder->CreateAdd(MemSrc, JITState.IRBuilder->getInt64(CTX->MemoryMapper.GetBaseOffset<uint64_t>(0)));
+      MemSrc = JITState.IRBuilder->CreateAdd(MemSrc, GetHostPointer("MemoryBase", CTX->MemoryMapper.GetBaseOffset<void*>(0)));
       // Cast the pointer type correctly
       MemSrc = JITState.IRBuilder->CreateIntToPtr(MemSrc, Type::getIntNTy(*Con, OpSize * 8)->getPointerTo());
 
       Src1 = JITState.IRBuilder->CreateZExtOrTrunc(Src1, MemSrc->getType()->getPointerElementType());
       Src2 = JITState.IRBuilder->CreateZExtOrTrunc(Src2, MemSrc->getType()->getPointerElementType());
 
-      llvm::Value *Result = JITState.IRBuilder->CreateAtomicCmpXchg(MemSrc, Src1, Src2, llvm::AtomicOrdering::SequentiallyConsistent, llvm::AtomicOrdering::SequentiallyConsistent);
+      llvm::Value *Result = JITState.IRBuilder->CreateAtomicCmpXchg(MemSrc, Src1, Src2, llvm::MaybeAlign(), llvm::AtomicOrdering::SequentiallyConsistent, llvm::AtomicOrdering::SequentiallyConsistent);
 
       // Result is a { <Type>, i1 } So we need to extract it first
       // Behaves exactly like std::atomic::compare_exchange_strong(Desired (Src1), Src2) ? Src1 : Desired
@@ -1893,7 +2193,7 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       auto Op = IROp->C<IR::IROp_LoadMem>();
       auto Src = GetSrc(Op->Header.Args[0]);
 
-      Src = JITState.IRBuilder->CreateAdd(Src, JITState.IRBuilder->getInt64(CTX->MemoryMapper.GetBaseOffset<uint64_t>(0)));
+      Src = JITState.IRBuilder->CreateAdd(Src, GetHostPointer("MemoryBase", CTX->MemoryMapper.GetBaseOffset<void*>(0)));
       // Cast the pointer type correctly
       Src = JITState.IRBuilder->CreateIntToPtr(Src, Type::getIntNTy(*Con, Op->Size * 8)->getPointerTo());
       auto Result = CreateMemoryLoad(Src, Op->Align);
@@ -1906,13 +2206,82 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       auto Dst = GetSrc(Op->Header.Args[0]);
       auto Src = GetSrc(Op->Header.Args[1]);
 
-      Dst = JITState.IRBuilder->CreateAdd(Dst, JITState.IRBuilder->getInt64(CTX->MemoryMapper.GetBaseOffset<uint64_t>(0)));
+      Dst = JITState.IRBuilder->CreateAdd(Dst, GetHostPointer("MemoryBase", CTX->MemoryMapper.GetBaseOffset<void*>(0)));
       auto Type = Type::getIntNTy(*Con, Op->Size * 8);
       Src = JITState.IRBuilder->CreateZExtOrTrunc(Src, Type);
       Dst = JITState.IRBuilder->CreateIntToPtr(Dst, Type->getPointerTo());
       CreateMemoryStore(Dst, Src, Op->Align);
     break;
     }
+    case IR::OP_MEMSET:
+    case IR::OP_MEMCPY:
+    case IR::OP_MEMCMP:
+    case IR::OP_MEMSCAN: {
+      // These get handled out of line by the same helpers the interpreter uses
+      // Every helper argument is 64bit, pointers are turned in to host pointers before the call
+      auto i64 = Type::getInt64Ty(*Con);
+      auto MemoryBase = GetHostPointer("MemoryBase", CTX->MemoryMapper.GetBaseOffset<void*>(0));
+      auto GetArg = [&](uint8_t Arg) {
+        return JITState.IRBuilder->CreateZExtOrTrunc(GetSrc(IROp->Args[Arg]), i64);
+      };
+
+      std::vector<llvm::Value*> Args;
+      void const *Helper{};
+      char const *HelperName{};
+      uint8_t Size{};
+      uint8_t StopOnEqual{};
+      switch (IROp->Op) {
+        case IR::OP_MEMSET:
+          Helper = reinterpret_cast<void const*>(BulkMemory::MemSet);
+          HelperName = "BulkMemory::MemSet";
+          Size = IROp->C<IR::IROp_MemSet>()->Size;
+          Args.emplace_back(JITState.IRBuilder->CreateAdd(GetArg(0), MemoryBase));
+          Args.emplace_back(GetArg(1));
+        break;
+        case IR::OP_MEMCPY:
+          Helper = reinterpret_cast<void const*>(BulkMemory::MemCpy);
+          HelperName = "BulkMemory::MemCpy";
+          Size = IROp->C<IR::IROp_MemCpy>()->Size;
+          Args.emplace_back(JITState.IRBuilder->CreateAdd(GetArg(0), MemoryBase));
+          Args.emplace_back(JITState.IRBuilder->CreateAdd(GetArg(1), MemoryBase));
+        break;
+        case IR::OP_MEMCMP:
+          Helper = reinterpret_cast<void const*>(BulkMemory::MemCmp);
+          HelperName = "BulkMemory::MemCmp";
+          Size = IROp->C<IR::IROp_MemCmp>()->Size;
+          StopOnEqual = IROp->C<IR::IROp_MemCmp>()->StopOnEqual;
+          Args.emplace_back(JITState.IRBuilder->CreateAdd(GetArg(0), MemoryBase));
+          Args.emplace_back(JITState.IRBuilder->CreateAdd(GetArg(1), MemoryBase));
+        break;
+        default:
+          Helper = reinterpret_cast<void const*>(BulkMemory::MemScan);
+          HelperName = "BulkMemory::MemScan";
+          Size = IROp->C<IR::IROp_MemScan>()->Size;
+          StopOnEqual = IROp->C<IR::IROp_MemScan>()->StopOnEqual;
+          Args.emplace_back(JITState.IRBuilder->CreateAdd(GetArg(0), MemoryBase));
+          Args.emplace_back(GetArg(1));
+        break;
+      }
+
+      // Length, Backwards, Size
+      Args.emplace_back(GetArg(2));
+      Args.emplace_back(GetArg(3));
+      Args.emplace_back(JITState.IRBuilder->getInt64(Size));
+
+      bool HasDest = IROp->HasDest;
+      if (HasDest) {
+        Args.emplace_back(JITState.IRBuilder->getInt64(StopOnEqual));
+      }
+
+      std::vector<llvm::Type*> ArgTypes(Args.size(), i64);
+      auto FuncType = FunctionType::get(HasDest ? i64 : Type::getVoidTy(*Con), ArgTypes, false);
+      auto Func = JITState.IRBuilder->CreateIntToPtr(GetHostPointer(HelperName, Helper), FuncType->getPointerTo());
+      auto Result = JITState.IRBuilder->CreateCall(FuncType, Func, Args);
+      if (HasDest) {
+        SetDest(*WrapperOp, Result);
+      }
+    break;
+    }
     case IR::OP_DUMMY:
     break;
     default:
@@ -1921,7 +2290,53 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
   }
 }
 
-void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData) {
+llvm::Function *LLVMJITCore::CreateBlockFunction(uint64_t Entry, llvm::Module *Module) {
+  using namespace llvm;
+
+  std::ostringstream FunctionName;
+  FunctionName << "Function_0x";
+  FunctionName << std::hex << Entry;
+
+  Type *i64 = Type::getInt64Ty(*Con);
+  auto FunctionType = FunctionType::get(Type::getVoidTy(*Con),
+    {
+      i64,
+    }, false);
+  auto BlockFunction = Function::Create(FunctionType,
+    Function::ExternalLinkage,
+    FunctionName.str(),
+    Module);
+
+  BlockFunction->setCallingConv(CallingConv::C);
+  return BlockFunction;
+}
+
+bool LLVMJITCore::GetEntryRIPOffset(llvm::Value *Value, uint64_t *Offset) {
+  using namespace llvm;
+
+  if (Value == JITCurrentState.EntryRIP) {
+    *Offset = 0;
+    return true;
+  }
+
+  // Walk through adds of constants, (EntryRIP + A) + B
+  auto Add = dyn_cast<BinaryOperator>(Value);
+  if (!Add || Add->getOpcode() != Instruction::Add) {
+    return false;
+  }
+
+  for (unsigned i = 0; i < 2; ++i) {
+    auto Const = dyn_cast<ConstantInt>(Add->getOperand(i));
+    if (Const && GetEntryRIPOffset(Add->getOperand(i ^ 1), Offset)) {
+      *Offset += Const->getZExtValue();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void LLVMJITCore::EmitBlockFunction(FEXCore::IR::IRListView<true> const *IR, llvm::Function *BlockFunction) {
   using namespace llvm;
   JumpTargets.clear();
   JITCurrentState.Blocks.clear();
@@ -1946,28 +2361,9 @@ void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const
   auto HeaderOp = HeaderNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
   LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
 
-  std::ostringstream FunctionName;
-  FunctionName << "Function_0x";
-  FunctionName << std::hex << HeaderOp->Entry;
-
-  auto FunctionModule = new llvm::Module("Module", *Con);
-  auto EngineBuilder = llvm::EngineBuilder(std::unique_ptr<llvm::Module>(FunctionModule));
-  EngineBuilder.setEngineKind(llvm::EngineKind::JIT);
-  EngineBuilder.setMCJITMemoryManager(std::unique_ptr<llvm::RTDyldMemoryManager>(JITState.MemManager));
-
-  auto Engine = EngineBuilder.create(LLVMTarget);
-
-  Type *i64 = Type::getInt64Ty(*Con);
-  auto FunctionType = FunctionType::get(Type::getVoidTy(*Con),
-    {
-      i64,
-    }, false);
-  Func = Function::Create(FunctionType,
-    Function::ExternalLinkage,
-    FunctionName.str(),
-    FunctionModule);
-
-  Func->setCallingConv(CallingConv::C);
+  Func = BlockFunction;
+  JITCurrentState.Entry = HeaderOp->Entry;
+  JITCurrentState.EntryRIP = nullptr;
 
   auto Builder = JITState.IRBuilder;
 
@@ -1976,8 +2372,6 @@ void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const
   JITState.IRBuilder->SetInsertPoint(Entry);
   JITCurrentState.CurrentBlock = Entry;
 
-  CreateGlobalVariables(Engine, FunctionModule);
-
   {
     IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
 
@@ -2027,6 +2421,7 @@ void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const
 
     JITState.IRBuilder->SetInsertPoint(Block);
     JITCurrentState.CurrentBlock = Block;
+    JITCurrentState.ExitRIPKnown = false;
 
     while (1) {
       HandleIR(CurrentIR, &CodeBegin);
@@ -2044,49 +2439,223 @@ void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const
       BlockNode = BlockIROp->Next.GetNode(ListBegin);
     }
   }
+}
 
-  llvm::ModulePassManager MPM;
+void LLVMJITCore::ReleaseBlock(uint64_t Entry) {
+  auto Tracker = JITState.Trackers.find(Entry);
+  if (Tracker != JITState.Trackers.end()) {
+    JITState.ReleasedTrackers.emplace_back(std::move(Tracker->second));
+    JITState.Trackers.erase(Tracker);
+  }
 
-  llvm::LoopAnalysisManager LAM;
-  llvm::FunctionAnalysisManager FAM;
-  llvm::CGSCCAnalysisManager CGAM;
-  llvm::ModuleAnalysisManager MAM;
+  auto BatchBlock = JITState.BatchBlocks.find(Entry);
+  if (BatchBlock != JITState.BatchBlocks.end()) {
+    auto Batch = BatchBlock->second.Owner;
 
-  llvm::PassBuilder passBuilder(LLVMTarget);
+    // Blocks in the batch that chain to this one go through the dispatcher from now on
+    *BatchBlock->second.Link = nullptr;
+    JITState.BatchBlocks.erase(BatchBlock);
 
-  passBuilder.registerLoopAnalyses(LAM);
-  passBuilder.registerFunctionAnalyses(FAM);
-  passBuilder.registerCGSCCAnalyses(CGAM);
-  passBuilder.registerModuleAnalyses(MAM);
+    // Every function in the batch is in a single allocation, it can only go once all of them are released
+    if (--Batch->LiveBlocks == 0) {
+      JITState.ReleasedDylibs.emplace_back(Batch->Dylib);
+    }
+  }
+}
 
-  passBuilder.crossRegisterProxies(LAM, FAM, CGAM, MAM);
+void LLVMJITCore::FreeReleasedCode() {
+  for (auto &Tracker : JITState.ReleasedTrackers) {
+    llvm::cantFail(Tracker->remove());
+  }
+  JITState.ReleasedTrackers.clear();
 
-  MPM = passBuilder.buildModuleOptimizationPipeline(
-    llvm::PassBuilder::OptimizationLevel::O3);
+  for (auto Dylib : JITState.ReleasedDylibs) {
+    llvm::cantFail(Dylib->clear());
+  }
+  JITState.ReleasedDylibs.clear();
+}
 
-  raw_ostream &Out = outs();
+void LLVMJITCore::InvalidateGuestCodeRange(uint64_t Address, uint64_t Size) {
+  std::vector<uint64_t> Entries;
+  for (auto &Tracker : JITState.Trackers) {
+    if (Tracker.first >= Address && Tracker.first < (Address + Size)) {
+      Entries.emplace_back(Tracker.first);
+    }
+  }
 
-  if (CTX->Config.LLVM_PrinterPass)
-  {
-    MPM.addPass(PrintModulePass(Out));
+  for (auto &Block : JITState.BatchBlocks) {
+    if (Block.first >= Address && Block.first < (Address + Size)) {
+      Entries.emplace_back(Block.first);
+    }
   }
 
-  if (CTX->Config.LLVM_IRValidation)
-  {
-    verifyModule(*FunctionModule, &Out);
+  for (auto Entry : Entries) {
+    ReleaseBlock(Entry);
   }
+}
 
-  MPM.run(*FunctionModule, MAM);
-  Engine->finalizeObject();
+void LLVMJITCore::AddModuleKey(std::string *Key, FEXCore::IR::IRListView<true> const *IR) {
+  Key->append(reinterpret_cast<char const*>(IR->GetData()), IR->GetDataSize());
+  Key->append(reinterpret_cast<char const*>(IR->GetListData()), IR->GetListSize());
+}
 
-  JITState.Functions.emplace_back(Engine);
+void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData) {
+  using namespace llvm;
+
+  uintptr_t ListBegin = IR->GetListData();
+  uintptr_t DataBegin = IR->GetData();
+
+  auto HeaderIterator = IR->begin();
+  IR::OrderedNodeWrapper *HeaderNodeWrapper = HeaderIterator();
+  IR::OrderedNode *HeaderNode = HeaderNodeWrapper->GetNode(ListBegin);
+  auto HeaderOp = HeaderNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+  LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
+
+  auto FunctionModule = new llvm::Module("Module", *Con);
+  FunctionModule->setDataLayout(JITState.JIT->getDataLayout());
+
+  std::string Key = BackendOptions;
+  AddModuleKey(&Key, IR);
+  Cache.SetModuleKey(FunctionModule, Key);
+
+  CreateGlobalVariables(FunctionModule);
+
+  auto BlockFunction = CreateBlockFunction(HeaderOp->Entry, FunctionModule);
+  auto FunctionName = BlockFunction->getName().str();
+  EmitBlockFunction(IR, BlockFunction);
+  DefineHostSymbols();
+
+  // If this block was compiled before then the old code is dead, release it before the new definition goes in
+  ReleaseBlock(HeaderOp->Entry);
+  FreeReleasedCode();
+
+  auto Tracker = JITState.JIT->getMainJITDylib().createResourceTracker();
+  if (auto Err = JITState.JIT->addIRModule(Tracker, orc::ThreadSafeModule(std::unique_ptr<llvm::Module>(FunctionModule), JITState.Context))) {
+    LogMan::Msg::A("Couldn't add module: %s", toString(std::move(Err)).c_str());
+    return nullptr;
+  }
+
+  // Looking up the function is what materializes the module
+  auto Symbol = JITState.JIT->lookup(FunctionName);
+  if (!Symbol) {
+    LogMan::Msg::A("Couldn't compile %s: %s", FunctionName.c_str(), toString(Symbol.takeError()).c_str());
+    return nullptr;
+  }
 
-  DebugData->HostCodeSize = JITState.MemManager->GetLastCodeAllocation();
-  void *FunctionPtr = reinterpret_cast<void*>(Engine->getFunctionAddress(FunctionName.str()));
+  JITState.Trackers[HeaderOp->Entry] = std::move(Tracker);
+
+  if (DebugData) {
+    DebugData->HostCodeSize = JITState.LastCodeSize;
+  }
+  void *FunctionPtr = reinterpret_cast<void*>(Symbol->getAddress());
 
   return FunctionPtr;
 }
 
+void LLVMJITCore::CompileCodeBatch(std::vector<BatchBlock> &Blocks) {
+  // Huge modules take a long time to optimize and keep a lot of memory alive, split them up
+  for (size_t i = 0; i < Blocks.size(); i += MAX_BATCH_BLOCKS) {
+    CompileBatch(&Blocks[i], std::min(MAX_BATCH_BLOCKS, Blocks.size() - i));
+  }
+}
+
+void LLVMJITCore::CompileBatch(BatchBlock *Blocks, size_t Count) {
+  using namespace llvm;
+
+  auto FunctionModule = new llvm::Module("Batch", *Con);
+  FunctionModule->setDataLayout(JITState.JIT->getDataLayout());
+
+  CreateGlobalVariables(FunctionModule);
+
+  // Every function needs to exist up front so that blocks can jump directly to any other block in the batch
+  std::vector<uint64_t> Entries(Count);
+  std::string Key = BackendOptions;
+  for (size_t i = 0; i < Count; ++i) {
+    auto IR = Blocks[i].IR;
+    auto HeaderOp = IR->begin()()->GetNode(IR->GetListData())->Op(IR->GetData())->C<FEXCore::IR::IROp_IRHeader>();
+    LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
+
+    Entries[i] = HeaderOp->Entry;
+    auto Function = CreateBlockFunction(Entries[i], FunctionModule);
+    JITState.BatchFunctions[Entries[i]] = Function;
+    JITState.BatchLinks[Entries[i]] = new GlobalVariable(*FunctionModule, Function->getType(), false, GlobalValue::ExternalLinkage, Function, "Link_" + Function->getName());
+    AddModuleKey(&Key, IR);
+  }
+  Cache.SetModuleKey(FunctionModule, Key);
+
+  for (size_t i = 0; i < Count; ++i) {
+    EmitBlockFunction(Blocks[i].IR, JITState.BatchFunctions[Entries[i]]);
+  }
+  DefineHostSymbols();
+
+  std::vector<std::string> FunctionNames(Count);
+  std::vector<std::string> LinkNames(Count);
+  for (size_t i = 0; i < Count; ++i) {
+    FunctionNames[i] = JITState.BatchFunctions[Entries[i]]->getName().str();
+    LinkNames[i] = JITState.BatchLinks[Entries[i]]->getName().str();
+  }
+  JITState.BatchFunctions.clear();
+  JITState.BatchLinks.clear();
+
+  auto Dylib = JITState.JIT->createJITDylib("Batch_" + std::to_string(JITState.Batches.size()));
+  if (!Dylib) {
+    LogMan::Msg::A("Couldn't create batch JITDylib: %s", toString(Dylib.takeError()).c_str());
+    delete FunctionModule;
+    return;
+  }
+  // Host functions live in the main JITDylib
+  Dylib->addToLinkOrder(JITState.JIT->getMainJITDylib());
+
+  if (auto Err = JITState.JIT->addIRModule(*Dylib, orc::ThreadSafeModule(std::unique_ptr<llvm::Module>(FunctionModule), JITState.Context))) {
+    LogMan::Msg::A("Couldn't add batch module: %s", toString(std::move(Err)).c_str());
+    return;
+  }
+
+  auto Batch = JITState.Batches.emplace_back(std::make_unique<LLVMState::Batch>()).get();
+  Batch->Dylib = &*Dylib;
+  Batch->LiveBlocks = 0;
+
+  // The first lookup materializes the whole module
+  std::vector<std::pair<uintptr_t, size_t>> Functions;
+  for (size_t i = 0; i < Count; ++i) {
+    auto Symbol = JITState.JIT->lookup(*Dylib, FunctionNames[i]);
+    if (!Symbol) {
+      LogMan::Msg::A("Couldn't compile %s: %s", FunctionNames[i].c_str(), toString(Symbol.takeError()).c_str());
+      continue;
+    }
+
+    auto Link = JITState.JIT->lookup(*Dylib, LinkNames[i]);
+    if (!Link) {
+      LogMan::Msg::A("Couldn't find %s: %s", LinkNames[i].c_str(), toString(Link.takeError()).c_str());
+      continue;
+    }
+
+    ReleaseBlock(Entries[i]);
+    JITState.BatchBlocks[Entries[i]] = LLVMState::BatchBlock{Batch, reinterpret_cast<void**>(Link->getAddress())};
+    ++Batch->LiveBlocks;
+
+    Blocks[i].CodePtr = reinterpret_cast<void*>(Symbol->getAddress());
+    Functions.emplace_back(Symbol->getAddress(), i);
+  }
+  FreeReleasedCode();
+
+  // There is only one code allocation for the whole batch, the functions are packed in to it one after another
+  std::sort(Functions.begin(), Functions.end());
+  for (size_t i = 0; i < Functions.size(); ++i) {
+    auto DebugData = Blocks[Functions[i].second].DebugData;
+    if (!DebugData) {
+      continue;
+    }
+
+    if (i + 1 < Functions.size()) {
+      DebugData->HostCodeSize = Functions[i + 1].first - Functions[i].first;
+    }
+    else {
+      DebugData->HostCodeSize = JITState.LastCodeSize - (Functions[i].first - Functions[0].first);
+    }
+  }
+}
+
 FEXCore::CPU::CPUBackend *CreateLLVMCore(FEXCore::Core::InternalThreadState *Thread) {
   return new LLVMJITCore(Thread);
 }
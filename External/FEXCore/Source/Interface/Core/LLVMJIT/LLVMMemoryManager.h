@@ -1,34 +1,26 @@
 #pragma once
-#include <llvm/ExecutionEngine/RTDyldMemoryManager.h>
+#include <llvm/ExecutionEngine/SectionMemoryManager.h>
 
 namespace FEXCore::CPU {
 
-class LLVMMemoryManager final : public llvm::RTDyldMemoryManager {
+/**
+ * @brief Memory manager for a single block's object
+ *
+ * ORC creates one of these per object and destroys it when the block's resource tracker is removed
+ * which releases the block's code and data back to the host
+ */
+class LLVMMemoryManager final : public llvm::SectionMemoryManager {
 public:
-  LLVMMemoryManager();
-  ~LLVMMemoryManager();
-//  uint64_t getSymbolAddress(const std::string &Name) override;
-
-  llvm::JITSymbol findSymbol(const std::string &Name) override;
+  /**
+   * @param CodeSize - Where the size of the last code allocation gets written, used for host code size stats
+   */
+  explicit LLVMMemoryManager(size_t *CodeSize);
 
   uint8_t *allocateCodeSection(uintptr_t Size, unsigned Alignment,
                                unsigned SectionID,
                                llvm::StringRef SectionName) override;
 
-  uint8_t *allocateDataSection(uintptr_t Size, unsigned Alignment,
-                               unsigned SectionID,
-                               llvm::StringRef SectionName,
-                               bool IsReadOnly) override;
-
-  bool finalizeMemory(std::string *ErrMsg) override;
-
-  size_t GetLastCodeAllocation() { return LastCodeSize; }
-
 private:
-  constexpr static size_t CODE_SIZE = 128 * 1024 * 1024;
-  uintptr_t CodeMemory {};
-  size_t AllocateOffset {};
-
-  size_t LastCodeSize {};
+  size_t *LastCodeSize;
 };
 }
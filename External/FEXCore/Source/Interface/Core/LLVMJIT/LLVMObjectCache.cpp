@@ -0,0 +1,120 @@
+#include "Interface/Core/LLVMJIT/LLVMObjectCache.h"
+#include "LogManager.h"
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SHA1.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unistd.h>
+
+namespace FEXCore::CPU {
+
+LLVMObjectCache::LLVMObjectCache(std::string const &CacheDir)
+  : Dir {CacheDir} {
+}
+
+void LLVMObjectCache::SetModuleKey(llvm::Module *M, std::string const &Key) {
+  auto Digest = llvm::SHA1::hash(llvm::arrayRefFromStringRef(Key));
+  auto Identifier = "FEX_" + llvm::toHex(Digest, true);
+
+  M->setModuleIdentifier(Identifier);
+  Keys[Identifier] = Key;
+}
+
+std::string LLVMObjectCache::GetObjectPath(llvm::Module const *M) const {
+  return Dir + M->getModuleIdentifier() + ".o";
+}
+
+void LLVMObjectCache::notifyObjectCompiled(llvm::Module const *M, llvm::MemoryBufferRef Obj) {
+  auto Key = Keys.find(M->getModuleIdentifier());
+  if (Key == Keys.end()) {
+    // Not a module that the JIT gave a key
+    return;
+  }
+
+  auto Path = GetObjectPath(M);
+
+  // Other threads and processes can be writing the same object, write it out fully before it becomes visible
+  auto TmpPath = Path + "." + std::to_string(getpid()) + "." + std::to_string(reinterpret_cast<uintptr_t>(this));
+  std::ofstream Output (TmpPath.c_str(), std::ios::out | std::ios::binary);
+  if (!Output.is_open()) {
+    Keys.erase(Key);
+    return;
+  }
+
+  // Entries start with the key so that getObject can check that it is the object it asked for
+  uint64_t KeySize = Key->second.size();
+  Output.write(reinterpret_cast<char const*>(&KeySize), sizeof(KeySize));
+  Output.write(Key->second.data(), KeySize);
+  Output.write(Obj.getBufferStart(), Obj.getBufferSize());
+  Output.close();
+  Keys.erase(Key);
+
+  if (!Output || rename(TmpPath.c_str(), Path.c_str()) != 0) {
+    LogMan::Msg::D("Couldn't write cached object %s", Path.c_str());
+    unlink(TmpPath.c_str());
+  }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> LLVMObjectCache::LoadObject(llvm::Module const *M) {
+  auto Key = Keys.find(M->getModuleIdentifier());
+  if (Key == Keys.end()) {
+    return nullptr;
+  }
+
+  auto Buffer = llvm::MemoryBuffer::getFile(GetObjectPath(M), -1, false);
+  if (!Buffer) {
+    return nullptr;
+  }
+
+  auto Data = (*Buffer)->getBuffer();
+  uint64_t KeySize;
+  if (Data.size() < sizeof(KeySize)) {
+    return nullptr;
+  }
+  memcpy(&KeySize, Data.data(), sizeof(KeySize));
+  Data = Data.drop_front(sizeof(KeySize));
+
+  // Anything else at this path is a different module that happens to share the digest, or a stale entry
+  if (KeySize != Key->second.size() || !Data.startswith(Key->second)) {
+    return nullptr;
+  }
+
+  return llvm::MemoryBuffer::getMemBufferCopy(Data.drop_front(KeySize), M->getModuleIdentifier());
+}
+
+std::unique_ptr<llvm::MemoryBuffer> LLVMObjectCache::getObject(llvm::Module const *M) {
+  std::unique_ptr<llvm::MemoryBuffer> Object;
+
+  auto Stashed = Loaded.find(M->getModuleIdentifier());
+  if (Stashed != Loaded.end()) {
+    Object = std::move(Stashed->second);
+    Loaded.erase(Stashed);
+  }
+  else {
+    Object = LoadObject(M);
+  }
+
+  if (Object) {
+    // Won't get compiled, so notifyObjectCompiled won't be around to drop the key
+    Keys.erase(M->getModuleIdentifier());
+  }
+
+  return Object;
+}
+
+bool LLVMObjectCache::HasObject(llvm::Module const *M) {
+  auto Object = LoadObject(M);
+  if (!Object) {
+    return false;
+  }
+
+  Loaded[M->getModuleIdentifier()] = std::move(Object);
+  return true;
+}
+
+}
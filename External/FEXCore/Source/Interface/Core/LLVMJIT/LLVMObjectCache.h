@@ -0,0 +1,49 @@
+#pragma once
+#include <llvm/ExecutionEngine/ObjectCache.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace FEXCore::CPU {
+
+/**
+ * @brief On disk cache of compiled block objects
+ *
+ * Objects are stored under a SHA1 of their module's key, which the JIT builds from the module's FEX IR and backend options
+ * Every entry holds the full key it was compiled from, an entry is only used if the key matches
+ * Objects only reference host state through external symbols so they can be relocated in to any process
+ */
+class LLVMObjectCache final : public llvm::ObjectCache {
+public:
+  /**
+   * @param CacheDir - Directory that the objects get written to and read from
+   */
+  explicit LLVMObjectCache(std::string const &CacheDir);
+
+  /**
+   * @brief Names the module after its key and remembers the key until the module is compiled
+   */
+  void SetModuleKey(llvm::Module *M, std::string const &Key);
+
+  void notifyObjectCompiled(llvm::Module const *M, llvm::MemoryBufferRef Obj) override;
+  std::unique_ptr<llvm::MemoryBuffer> getObject(llvm::Module const *M) override;
+
+  /**
+   * @brief Checks if the module's object is already in the cache
+   *
+   * Lets the JIT skip optimizing modules that will never get compiled
+   */
+  bool HasObject(llvm::Module const *M);
+
+private:
+  std::string GetObjectPath(llvm::Module const *M) const;
+  std::unique_ptr<llvm::MemoryBuffer> LoadObject(llvm::Module const *M);
+
+  std::string Dir;
+
+  // Full key of every module that hasn't been compiled yet, keyed by module identifier
+  std::unordered_map<std::string, std::string> Keys;
+  // Object that HasObject already loaded, handed out by the getObject call that follows
+  std::unordered_map<std::string, std::unique_ptr<llvm::MemoryBuffer>> Loaded;
+};
+}
@@ -50,7 +50,7 @@ void OpDispatchBuilder::SyscallOp(OpcodeArgs) {
     FEXCore::X86State::REG_R9,
   };
 
-  auto NewRIP = _Constant(Op->PC);
+  auto NewRIP = GetRelocatedPC(Op->PC);
   _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), NewRIP);
 
   auto SyscallOp = _Syscall(
@@ -266,12 +266,12 @@ void OpDispatchBuilder::LEAVEOp(OpcodeArgs) {
 
 void OpDispatchBuilder::CALLOp(OpcodeArgs) {
   BlockSetRIP = true;
-  auto ConstantPC = _Constant(Op->PC + Op->InstSize);
+  auto ConstantPC = GetRelocatedPC(Op->PC + Op->InstSize);
 
   OrderedNode *JMPPCOffset = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
 
   OrderedNode *NewRIP = _Add(JMPPCOffset, ConstantPC);
-  auto ConstantPCReturn = _Constant(Op->PC + Op->InstSize);
+  auto ConstantPCReturn = ConstantPC;
 
   auto ConstantSize = _Constant(8);
   auto OldSP = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSP]), GPRClass);
@@ -293,7 +293,7 @@ void OpDispatchBuilder::CALLAbsoluteOp(OpcodeArgs) {
 
   OrderedNode *JMPPCOffset = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
 
-  auto ConstantPCReturn = _Constant(Op->PC + Op->InstSize);
+  auto ConstantPCReturn = GetRelocatedPC(Op->PC + Op->InstSize);
 
   auto ConstantSize = _Constant(8);
   auto OldSP = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSP]), GPRClass);
@@ -486,7 +486,7 @@ void OpDispatchBuilder::CondJUMPOp(OpcodeArgs) {
       SetCurrentCodeBlock(JumpTarget);
 
       auto RIPOffset = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-      auto RIPTargetConst = _Constant(Op->PC + Op->InstSize);
+      auto RIPTargetConst = GetRelocatedPC(Op->PC + Op->InstSize);
 
       auto NewRIP = _Add(RIPOffset, RIPTargetConst);
 
@@ -506,7 +506,7 @@ void OpDispatchBuilder::CondJUMPOp(OpcodeArgs) {
       SetCurrentCodeBlock(JumpTarget);
 
       // Leave block
-      auto RIPTargetConst = _Constant(Op->PC + Op->InstSize);
+      auto RIPTargetConst = GetRelocatedPC(Op->PC + Op->InstSize);
 
       // Store the new RIP
       _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), RIPTargetConst);
@@ -534,7 +534,7 @@ void OpDispatchBuilder::JUMPOp(OpcodeArgs) {
       auto JumpTarget = CreateNewCodeBlock();
       SetJumpTarget(Jump, JumpTarget);
       SetCurrentCodeBlock(JumpTarget);
-      _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), _Constant(Target));
+      _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), GetRelocatedPC(Target));
       _ExitFunction();
     }
     return;
@@ -545,7 +545,7 @@ void OpDispatchBuilder::JUMPOp(OpcodeArgs) {
     // This source is a literal
     auto RIPOffset = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
 
-    auto RIPTargetConst = _Constant(Op->PC + Op->InstSize);
+    auto RIPTargetConst = GetRelocatedPC(Op->PC + Op->InstSize);
 
 		auto NewRIP = _Add(RIPOffset, RIPTargetConst);
 
@@ -1746,72 +1746,30 @@ void OpDispatchBuilder::DECOp(OpcodeArgs) {
   }
 }
 
+OrderedNode *OpDispatchBuilder::GetStringPointerOffset(OrderedNode *Count, OrderedNode *DF, uint8_t Size) {
+  auto Offset = _Lshl(Count, _Constant(__builtin_ctz(Size)));
+
+  return _Select(FEXCore::IR::COND_EQ,
+      DF, _Constant(0),
+      Offset, _Neg(Offset));
+}
+
 void OpDispatchBuilder::STOSOp(OpcodeArgs) {
   LogMan::Throw::A(Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_REP_PREFIX, "Can't handle REP not existing on STOS\n");
 
   auto Size = GetSrcSize(Op);
 
-  // Create all our blocks
-  auto LoopHead = CreateNewCodeBlock();
-  auto LoopTail = CreateNewCodeBlock();
-  auto LoopEnd = CreateNewCodeBlock();
-
-  // At the time this was written, our RA can't handle accessing nodes across blocks.
-  // So we need to re-load and re-calculate essential values each iteration of the loop.
-
-  // First thing we need to do is finish this block and jump to the start of the loop.
-  _Jump(LoopHead);
-
-    SetCurrentCodeBlock(LoopHead);
-    {
-      OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-      auto ZeroConst = _Constant(0);
-
-      // Can we end the block?
-      auto CanLeaveCond = _Select(FEXCore::IR::COND_EQ,
-          Counter, ZeroConst,
-          _Constant(1), ZeroConst);
-
-      _CondJump(CanLeaveCond, LoopEnd, LoopTail);
-    }
-
-    SetCurrentCodeBlock(LoopTail);
-    {
-      OrderedNode *Src = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-      OrderedNode *Dest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-
-      // Store to memory where RDI points
-      _StoreMem(GPRClass, Size, Dest, Src, Size);
-
-      OrderedNode *TailCounter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-      OrderedNode *TailDest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-
-      // Decrement counter
-      TailCounter = _Sub(TailCounter, _Constant(1));
-
-      // Store the counter so we don't have to deal with PHI here
-      _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), TailCounter);
-
-      auto SizeConst = _Constant(Size);
-      auto NegSizeConst = _Constant(-Size);
-
-      // Calculate direction.
-      auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
-      auto PtrDir = _Select(FEXCore::IR::COND_EQ,
-          DF,  _Constant(0),
-          SizeConst, NegSizeConst);
-
-      // Offset the pointer
-      TailDest = _Add(TailDest, PtrDir);
-      _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), TailDest);
-
-      // Jump back to the start, we have more work to do
-      _Jump(LoopHead);
-    }
+  OrderedNode *Src = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
+  OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+  OrderedNode *Dest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
+  auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
 
-  // Make sure to start a new block after ending this one
+  // The entire REP is a single op, only the final register state needs to be written back
+  _MemSet(Dest, Src, Counter, DF, Size);
 
-  SetCurrentCodeBlock(LoopEnd);
+  Dest = _Add(Dest, GetStringPointerOffset(Counter, DF, Size));
+  _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), Dest);
+  _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), _Constant(0));
 }
 
 void OpDispatchBuilder::MOVSOp(OpcodeArgs) {
@@ -1820,72 +1778,19 @@ void OpDispatchBuilder::MOVSOp(OpcodeArgs) {
   if (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_REP_PREFIX) {
     auto Size = GetSrcSize(Op);
 
-    // Create all our blocks
-    auto LoopHead = CreateNewCodeBlock();
-    auto LoopTail = CreateNewCodeBlock();
-    auto LoopEnd = CreateNewCodeBlock();
-
-    // At the time this was written, our RA can't handle accessing nodes across blocks.
-    // So we need to re-load and re-calculate essential values each iteration of the loop.
-
-    // First thing we need to do is finish this block and jump to the start of the loop.
-    _Jump(LoopHead);
-
-      SetCurrentCodeBlock(LoopHead);
-      {
-        OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-        auto ZeroConst = _Constant(0);
-
-        // Can we end the block?
-        auto CanLeaveCond = _Select(FEXCore::IR::COND_EQ,
-            Counter, ZeroConst,
-            _Constant(1), ZeroConst);
-
-        _CondJump(CanLeaveCond, LoopEnd, LoopTail);
-      }
-
-      SetCurrentCodeBlock(LoopTail);
-      {
-        OrderedNode *Src = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
-        OrderedNode *Dest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-
-        Src = _LoadMem(GPRClass, Size, Src, Size);
-
-        // Store to memory where RDI points
-        _StoreMem(GPRClass, Size, Dest, Src, Size);
-
-        OrderedNode *TailCounter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-
-        // Decrement counter
-        TailCounter = _Sub(TailCounter, _Constant(1));
-
-        // Store the counter so we don't have to deal with PHI here
-        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), TailCounter);
-
-        auto SizeConst = _Constant(Size);
-        auto NegSizeConst = _Constant(-Size);
-
-        // Calculate direction.
-        auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
-        auto PtrDir = _Select(FEXCore::IR::COND_EQ,
-            DF,  _Constant(0),
-            SizeConst, NegSizeConst);
-
-        // Offset the pointer
-        OrderedNode *TailSrc = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
-        OrderedNode *TailDest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-        TailSrc = _Add(TailSrc, PtrDir);
-        TailDest = _Add(TailDest, PtrDir);
-        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), TailSrc);
-        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), TailDest);
+    OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+    OrderedNode *Src = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
+    OrderedNode *Dest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
+    auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
 
-        // Jump back to the start, we have more work to do
-        _Jump(LoopHead);
-      }
+    _MemCpy(Dest, Src, Counter, DF, Size);
 
-    // Make sure to start a new block after ending this one
-
-    SetCurrentCodeBlock(LoopEnd);
+    auto PtrOffset = GetStringPointerOffset(Counter, DF, Size);
+    Src = _Add(Src, PtrOffset);
+    Dest = _Add(Dest, PtrOffset);
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), Src);
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), Dest);
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), _Constant(0));
   }
   else {
     auto Size = GetSrcSize(Op);
@@ -1915,150 +1820,106 @@ void OpDispatchBuilder::MOVSOp(OpcodeArgs) {
 }
 
 void OpDispatchBuilder::CMPSOp(OpcodeArgs) {
-  LogMan::Throw::A(Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_REP_PREFIX, "Can't only handle REP\n");
-  LogMan::Throw::A(!(Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_REPNE_PREFIX), "Can't only handle REP\n");
+  LogMan::Throw::A(Op->Flags & (FEXCore::X86Tables::DecodeFlags::FLAG_REP_PREFIX | FEXCore::X86Tables::DecodeFlags::FLAG_REPNE_PREFIX), "Can only handle REP or REPNE\n");
   LogMan::Throw::A(!(Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_ADDRESS_SIZE), "Can't handle adddress size\n");
   LogMan::Throw::A(!(Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_FS_PREFIX), "Can't handle FS\n");
   LogMan::Throw::A(!(Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_GS_PREFIX), "Can't handle GS\n");
 
   auto Size = GetSrcSize(Op);
+  // REPE stops on the first mismatch, REPNE on the first match
+  bool StopOnEqual = Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_REPNE_PREFIX;
 
-  auto JumpStart = _Jump();
-  // Make sure to start a new block after ending this one
-    auto LoopStart = CreateNewCodeBlock();
-    SetJumpTarget(JumpStart, LoopStart);
-    SetCurrentCodeBlock(LoopStart);
-
-    OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-
-    // Can we end the block?
-    OrderedNode *CanLeaveCond = _Select(FEXCore::IR::COND_EQ,
-      Counter, _Constant(0),
-      _Constant(1), _Constant(0));
-
-    auto CondJump = _CondJump(CanLeaveCond);
-    IRPair<IROp_CondJump> InternalCondJump;
-
-    auto LoopTail = CreateNewCodeBlock();
-    SetFalseJumpTarget(CondJump, LoopTail);
-    SetCurrentCodeBlock(LoopTail);
-
-    // Working loop
-    {
-      OrderedNode *Dest_RDI = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-      OrderedNode *Dest_RSI = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
+  OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
 
-      auto Src1 = _LoadMem(GPRClass, Size, Dest_RDI, Size);
-      auto Src2 = _LoadMem(GPRClass, Size, Dest_RSI, Size);
+  // Flags are left untouched if there is nothing to compare
+  OrderedNode *CanLeaveCond = _Select(FEXCore::IR::COND_EQ,
+    Counter, _Constant(0),
+    _Constant(1), _Constant(0));
 
-      auto ALUOp = _Sub(Src1, Src2);
-      GenerateFlags_SUB(Op, _Bfe(Size * 8, 0, ALUOp), _Bfe(Size * 8, 0, Src1), _Bfe(Size * 8, 0, Src2));
+  auto CondJump = _CondJump(CanLeaveCond);
 
-      OrderedNode *TailCounter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-
-      // Decrement counter
-      TailCounter = _Sub(TailCounter, _Constant(1));
-
-      // Store the counter so we don't have to deal with PHI here
-      _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), TailCounter);
+  auto CompareBlock = CreateNewCodeBlock();
+  SetFalseJumpTarget(CondJump, CompareBlock);
+  SetCurrentCodeBlock(CompareBlock);
+  IRPair<IROp_Jump> EndJump;
+  {
+    // At the time this was written, our RA can't handle accessing nodes across blocks.
+    Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+    OrderedNode *Src_RSI = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
+    OrderedNode *Src_RDI = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
+    auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
 
-      auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
-      auto PtrDir = _Select(FEXCore::IR::COND_EQ,
-          DF, _Constant(0),
-          _Constant(Size), _Constant(-Size));
+    auto Compared = _MemCmp(Src_RSI, Src_RDI, Counter, DF, Size, StopOnEqual);
 
-      // Offset the pointer
-      Dest_RDI = _Add(Dest_RDI, PtrDir);
-      _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), Dest_RDI);
+    // The last pair of elements compared is what sets the flags
+    auto LastOffset = GetStringPointerOffset(_Sub(Compared, _Constant(1)), DF, Size);
+    auto Src1 = _LoadMem(GPRClass, Size, _Add(Src_RSI, LastOffset), Size);
+    auto Src2 = _LoadMem(GPRClass, Size, _Add(Src_RDI, LastOffset), Size);
 
-      // Offset second pointer
-      Dest_RSI = _Add(Dest_RSI, PtrDir);
-      _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), Dest_RSI);
+    auto ALUOp = _Sub(Src1, Src2);
+    GenerateFlags_SUB(Op, _Bfe(Size * 8, 0, ALUOp), _Bfe(Size * 8, 0, Src1), _Bfe(Size * 8, 0, Src2));
 
-      OrderedNode *ZF = GetRFLAG(FEXCore::X86State::RFLAG_ZF_LOC);
-      InternalCondJump = _CondJump(ZF);
+    auto PtrOffset = GetStringPointerOffset(Compared, DF, Size);
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), _Add(Src_RSI, PtrOffset));
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), _Add(Src_RDI, PtrOffset));
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), _Sub(Counter, Compared));
 
-      // Jump back to the start if we have more work to do
-      SetTrueJumpTarget(InternalCondJump, LoopStart);
-    }
+    EndJump = _Jump();
+  }
 
   // Make sure to start a new block after ending this one
   auto LoopEnd = CreateNewCodeBlock();
   SetTrueJumpTarget(CondJump, LoopEnd);
-  SetFalseJumpTarget(InternalCondJump, LoopEnd);
+  SetJumpTarget(EndJump, LoopEnd);
   SetCurrentCodeBlock(LoopEnd);
 }
 
 void OpDispatchBuilder::SCASOp(OpcodeArgs) {
-  LogMan::Throw::A(Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_REPNE_PREFIX, "Can only handle REPNE\n");
+  LogMan::Throw::A(Op->Flags & (FEXCore::X86Tables::DecodeFlags::FLAG_REP_PREFIX | FEXCore::X86Tables::DecodeFlags::FLAG_REPNE_PREFIX), "Can only handle REP or REPNE\n");
 
   auto Size = GetSrcSize(Op);
+  // REPE stops on the first mismatch, REPNE on the first match
+  bool StopOnEqual = Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_REPNE_PREFIX;
 
-  auto JumpStart = _Jump();
-  // Make sure to start a new block after ending this one
-    auto LoopStart = CreateNewCodeBlock();
-    SetJumpTarget(JumpStart, LoopStart);
-    SetCurrentCodeBlock(LoopStart);
-
-      auto ZeroConst = _Constant(0);
-      auto OneConst = _Constant(1);
+  OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
 
-      OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+  // Flags are left untouched if there is nothing to compare
+  OrderedNode *CanLeaveCond = _Select(FEXCore::IR::COND_EQ,
+    Counter, _Constant(0),
+    _Constant(1), _Constant(0));
 
-      // Can we end the block?
-      OrderedNode *CanLeaveCond = _Select(FEXCore::IR::COND_EQ,
-        Counter, ZeroConst,
-        OneConst, ZeroConst);
+  auto CondJump = _CondJump(CanLeaveCond);
 
-    // We leave if RCX = 0
-    auto CondJump = _CondJump(CanLeaveCond);
-    IRPair<IROp_CondJump> InternalCondJump;
-
-    auto LoopTail = CreateNewCodeBlock();
-    SetFalseJumpTarget(CondJump, LoopTail);
-    SetCurrentCodeBlock(LoopTail);
-
-    // Working loop
-    {
-      OrderedNode *Dest_RDI = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-
-      auto Src1 = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-      auto Src2 = _LoadMem(GPRClass, Size, Dest_RDI, Size);
-
-      auto ALUOp = _Sub(Src1, Src2);
-      GenerateFlags_SUB(Op, ALUOp, Src1, Src2);
-
-      OrderedNode *TailCounter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-      OrderedNode *TailDest_RDI = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-
-      // Decrement counter
-      TailCounter = _Sub(TailCounter, _Constant(1));
-
-      // Store the counter so we don't have to deal with PHI here
-      _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), TailCounter);
+  auto CompareBlock = CreateNewCodeBlock();
+  SetFalseJumpTarget(CondJump, CompareBlock);
+  SetCurrentCodeBlock(CompareBlock);
+  IRPair<IROp_Jump> EndJump;
+  {
+    // At the time this was written, our RA can't handle accessing nodes across blocks.
+    Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+    OrderedNode *Dest_RDI = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
+    auto Src1 = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
+    auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
 
-      auto SizeConst = _Constant(Size);
-      auto NegSizeConst = _Constant(-Size);
+    auto Compared = _MemScan(Dest_RDI, Src1, Counter, DF, Size, StopOnEqual);
 
-      auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
-      auto PtrDir = _Select(FEXCore::IR::COND_EQ,
-          DF, _Constant(0),
-          SizeConst, NegSizeConst);
+    // The last element compared is what sets the flags
+    auto LastOffset = GetStringPointerOffset(_Sub(Compared, _Constant(1)), DF, Size);
+    auto Src2 = _LoadMem(GPRClass, Size, _Add(Dest_RDI, LastOffset), Size);
 
-      // Offset the pointer
-      TailDest_RDI = _Add(TailDest_RDI, PtrDir);
-      _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), TailDest_RDI);
+    auto ALUOp = _Sub(Src1, Src2);
+    GenerateFlags_SUB(Op, _Bfe(Size * 8, 0, ALUOp), _Bfe(Size * 8, 0, Src1), _Bfe(Size * 8, 0, Src2));
 
-      OrderedNode *ZF = GetRFLAG(FEXCore::X86State::RFLAG_ZF_LOC);
-      InternalCondJump = _CondJump(ZF);
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), _Add(Dest_RDI, GetStringPointerOffset(Compared, DF, Size)));
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), _Sub(Counter, Compared));
 
-      // Jump back to the start if we have more work to do
-      SetFalseJumpTarget(InternalCondJump, LoopStart);
+    EndJump = _Jump();
   }
+
   // Make sure to start a new block after ending this one
   auto LoopEnd = CreateNewCodeBlock();
   SetTrueJumpTarget(CondJump, LoopEnd);
-  SetTrueJumpTarget(InternalCondJump, LoopEnd);
+  SetJumpTarget(EndJump, LoopEnd);
   SetCurrentCodeBlock(LoopEnd);
 }
 
@@ -2777,11 +2638,23 @@ void OpDispatchBuilder::CreateJumpBlocks(std::vector<FEXCore::Frontend::Decoder:
 void OpDispatchBuilder::BeginFunction(uint64_t RIP, std::vector<FEXCore::Frontend::Decoder::DecodedBlocks> const *Blocks) {
   Entry = RIP;
   auto IRHeader = _IRHeader(InvalidNode, RIP, 0);
+
+  // The prologue reads the RIP the function was entered at before anything can change it
+  // It gets its own block so nothing can jump back to it later
+  auto Prologue = CreateCodeNode();
+  SetCodeNodeBegin(Prologue, _Dummy());
+  SetCodeNodeLast(Prologue, _EndBlock(0));
+
   CreateJumpBlocks(Blocks);
+  Prologue.first->Next = CodeBlocks[1]->Wrapped(ListData.Begin());
 
   auto Block = GetNewJumpBlock(RIP);
+  SetCurrentCodeBlock(Prologue);
+  EntryRIP = _LoadContext(8, offsetof(FEXCore::Core::CPUState, rip), GPRClass);
+  _Jump(Block);
+
   SetCurrentCodeBlock(Block);
-  IRHeader.first->Blocks = Block->Wrapped(ListData.Begin());
+  IRHeader.first->Blocks = Prologue.Node->Wrapped(ListData.Begin());
 }
 
 void OpDispatchBuilder::Finalize() {
@@ -2796,7 +2669,7 @@ void OpDispatchBuilder::Finalize() {
 
     // We haven't emitted. Dump out to the dispatcher
     SetCurrentCodeBlock(Handler.second.BlockEntry);
-    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), _Constant(Handler.first));
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), GetRelocatedPC(Handler.first));
     _ExitFunction();
   }
   CodeBlocks.clear();
@@ -2877,7 +2750,7 @@ OrderedNode *OpDispatchBuilder::LoadSource_WithOpSize(FEXCore::IR::RegisterClass
     LoadableType = true;
   }
   else if (Operand.TypeNone.Type == FEXCore::X86Tables::DecodedOperand::TYPE_RIP_RELATIVE) {
-    Src = _Constant(Operand.TypeRIPLiteral.Literal + Op->PC + Op->InstSize);
+    Src = GetRelocatedPC(Operand.TypeRIPLiteral.Literal + Op->PC + Op->InstSize);
     LoadableType = true;
   }
   else if (Operand.TypeNone.Type == FEXCore::X86Tables::DecodedOperand::TYPE_SIB) {
@@ -2989,7 +2862,7 @@ void OpDispatchBuilder::StoreResult_WithOpSize(FEXCore::IR::RegisterClassType Cl
     MemStore = true;
   }
   else if (Operand.TypeNone.Type == FEXCore::X86Tables::DecodedOperand::TYPE_RIP_RELATIVE) {
-    MemStoreDst = _Constant(Operand.TypeRIPLiteral.Literal + Op->PC + Op->InstSize);
+    MemStoreDst = GetRelocatedPC(Operand.TypeRIPLiteral.Literal + Op->PC + Op->InstSize);
     MemStore = true;
   }
   else if (Operand.TypeNone.Type == FEXCore::X86Tables::DecodedOperand::TYPE_SIB) {
@@ -3075,6 +2948,7 @@ void OpDispatchBuilder::ResetWorkingList() {
   JumpTargets.clear();
   BlockSetRIP = false;
   CurrentWriteCursor = nullptr;
+  UseListsValid = false;
   // This is necessary since we do "null" pointer checks
   InvalidNode = reinterpret_cast<OrderedNode*>(ListData.Allocate(sizeof(OrderedNode)));
   DecodeFailure = false;
@@ -3736,7 +3610,7 @@ void OpDispatchBuilder::INTOp(OpcodeArgs) {
     BlockSetRIP = setRIP;
 
     // We want to set RIP to the next instruction after HLT/INT3
-    auto NewRIP = _Constant(Op->PC + Op->InstSize);
+    auto NewRIP = GetRelocatedPC(Op->PC + Op->InstSize);
     _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), NewRIP);
   }
 
@@ -4330,8 +4204,8 @@ void OpDispatchBuilder::ReplaceAllUsesWithInclusive(OrderedNode *Node, OrderedNo
     uint8_t NumArgs = IR::GetArgs(IROp->Op);
     for (uint8_t i = 0; i < NumArgs; ++i) {
       if (IROp->Args[i].ID() == Node->Wrapped(ListBegin).ID()) {
-        Node->RemoveUse();
-        NewNode->AddUse();
+        RemoveArgUse(Node, RealNode);
+        AddArgUse(NewNode, RealNode);
         IROp->Args[i].NodeOffset = NewNode->Wrapped(ListBegin).NodeOffset;
       }
     }
@@ -4341,15 +4215,161 @@ void OpDispatchBuilder::ReplaceAllUsesWithInclusive(OrderedNode *Node, OrderedNo
 }
 
 void OpDispatchBuilder::RemoveArgUses(OrderedNode *Node) {
+  ForEachUsedArg(Node, [this, Node](OrderedNode *Arg) {
+    RemoveArgUse(Arg, Node);
+  });
+}
+
+void OpDispatchBuilder::AddArgUses(OrderedNode *Node) {
+  ForEachUsedArg(Node, [this, Node](OrderedNode *Arg) {
+    AddArgUse(Arg, Node);
+  });
+}
+
+void OpDispatchBuilder::AddArgUse(OrderedNode *Arg, OrderedNode *User) {
+  Arg->AddUse();
+
+  if (UseListsValid) {
+    LinkUse(Arg->Wrapped(ListData.Begin()).ID(), User->Wrapped(ListData.Begin()).ID());
+  }
+}
+
+void OpDispatchBuilder::RemoveArgUse(OrderedNode *Arg, OrderedNode *User) {
+  Arg->RemoveUse();
+
+  if (UseListsValid) {
+    UnlinkUse(Arg->Wrapped(ListData.Begin()).ID(), User->Wrapped(ListData.Begin()).ID());
+  }
+}
+
+void OpDispatchBuilder::LinkArgUseLists(OrderedNode *User) {
+  uintptr_t ListBegin = ListData.Begin();
+  uint32_t UserID = User->Wrapped(ListBegin).ID();
+
+  // The use counts were already added when the op was created
+  ForEachUsedArg(User, [this, ListBegin, UserID](OrderedNode *Arg) {
+    LinkUse(Arg->Wrapped(ListBegin).ID(), UserID);
+  });
+}
+
+void OpDispatchBuilder::LinkUse(uint32_t Node, uint32_t User) {
+  if (Node >= UseListHeads.size()) {
+    UseListHeads.resize(ListData.Size() / sizeof(OrderedNode), 0);
+  }
+
+  uint32_t Entry = FreeUseEntries;
+  if (Entry) {
+    FreeUseEntries = UseEntries[Entry].Next;
+  }
+  else {
+    Entry = UseEntries.size();
+    UseEntries.emplace_back();
+  }
+
+  UseEntries[Entry].User = User;
+  UseEntries[Entry].Next = UseListHeads[Node];
+  UseListHeads[Node] = Entry;
+}
+
+void OpDispatchBuilder::UnlinkUse(uint32_t Node, uint32_t User) {
+  LogMan::Throw::A(Node < UseListHeads.size(), "%%ssa%d doesn't have a use list", Node);
+  uint32_t *Link = &UseListHeads[Node];
+  while (*Link) {
+    uint32_t Entry = *Link;
+    if (UseEntries[Entry].User == User) {
+      *Link = UseEntries[Entry].Next;
+      UseEntries[Entry].Next = FreeUseEntries;
+      FreeUseEntries = Entry;
+      return;
+    }
+    Link = &UseEntries[Entry].Next;
+  }
+
+  LogMan::Msg::A("%%ssa%d wasn't in the use list of %%ssa%d", User, Node);
+}
+
+void OpDispatchBuilder::BuildUseLists() {
+  UseListHeads.assign(ListData.Size() / sizeof(OrderedNode), 0);
+  // Entry zero terminates the lists
+  UseEntries.resize(1);
+  FreeUseEntries = 0;
+  UseListsValid = true;
+
+  auto CurrentIR = ViewIR();
+  uintptr_t ListBegin = CurrentIR.GetListData();
+  uintptr_t DataBegin = CurrentIR.GetData();
+
+  auto Begin = CurrentIR.begin();
+  auto HeaderOp = Begin()->GetNode(ListBegin)->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+  LogMan::Throw::A(HeaderOp->Header.Op == OP_IRHEADER, "First op wasn't IRHeader");
+
+  OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+  while (1) {
+    auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    LogMan::Throw::A(BlockIROp->Header.Op == OP_CODEBLOCK, "IR type failed to be a code block");
+
+    // We grab these nodes this way so we can iterate easily
+    auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+    auto CodeLast = CurrentIR.at(BlockIROp->Last);
+    while (1) {
+      LinkArgUseLists(CodeBegin()->GetNode(ListBegin));
+
+      // CodeLast is inclusive. So we still need to link the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+
+    if (BlockIROp->Next.ID() == 0) {
+      break;
+    } else {
+      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+    }
+  }
+}
+
+void OpDispatchBuilder::RewriteUses(OrderedNode *Node, OrderedNode *NewNode) {
+  if (!UseListsValid) {
+    BuildUseLists();
+  }
+
   uintptr_t ListBegin = ListData.Begin();
   uintptr_t DataBegin = Data.Begin();
 
-  FEXCore::IR::IROp_Header *IROp = Node->Op(DataBegin);
+  uint32_t NodeID = Node->Wrapped(ListBegin).ID();
+  uint32_t NewNodeID = NewNode->Wrapped(ListBegin).ID();
+  if (NodeID >= UseListHeads.size()) {
+    // Created after the lists were built and never used
+    return;
+  }
+
+  if (NewNodeID >= UseListHeads.size()) {
+    UseListHeads.resize(ListData.Size() / sizeof(OrderedNode), 0);
+  }
+
+  // Each entry is a single argument, move them over to the new node one at a time
+  while (UseListHeads[NodeID]) {
+    uint32_t Entry = UseListHeads[NodeID];
+    FEXCore::IR::IROp_Header *IROp = GetNode(UseEntries[Entry].User)->Op(DataBegin);
+    LogMan::Throw::A(IROp->Op != OP_PHI, "Can't rewrite the uses of a PhiValue");
+
+    // PhiValues use their value outside of the RA visible arguments
+    uint8_t NumArgs = IROp->Op == OP_PHIVALUE ? 1 : IR::GetArgs(IROp->Op);
+    for (uint8_t i = 0; i < NumArgs; ++i) {
+      if (IROp->Args[i].ID() == NodeID) {
+        IROp->Args[i].NodeOffset = NewNode->Wrapped(ListBegin).NodeOffset;
+        break;
+      }
+    }
+
+    Node->RemoveUse();
+    NewNode->AddUse();
 
-  uint8_t NumArgs = IR::GetArgs(IROp->Op);
-  for (uint8_t i = 0; i < NumArgs; ++i) {
-    auto ArgNode = IROp->Args[i].GetNode(ListBegin);
-    ArgNode->RemoveUse();
+    UseListHeads[NodeID] = UseEntries[Entry].Next;
+    UseEntries[Entry].Next = UseListHeads[NewNodeID];
+    UseListHeads[NewNodeID] = Entry;
   }
 }
 
@@ -4359,6 +4379,11 @@ void OpDispatchBuilder::Remove(OrderedNode *Node) {
   Node->Unlink(ListData.Begin());
 }
 
+void OpDispatchBuilder::MoveBefore(OrderedNode *Node, OrderedNode *Before) {
+  Node->Unlink(ListData.Begin());
+  Before->prepend(ListData.Begin(), Node);
+}
+
 void InstallOpcodeHandlers() {
   const std::vector<std::tuple<uint8_t, uint8_t, X86Tables::OpDispatchPtr>> BaseOpTable = {
     // Instructions
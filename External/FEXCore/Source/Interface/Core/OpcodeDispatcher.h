@@ -68,7 +68,7 @@ public:
       if (it == JumpTargets.end() && LastOp) {
         // If we don't have a jump target to a new block then we have to leave
         // Set the RIP to the next instruction and leave
-        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), _Constant(NextRIP));
+        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, rip), GetRelocatedPC(NextRIP));
         _ExitFunction();
       }
       else if (it != JumpTargets.end()) {
@@ -81,6 +81,14 @@ public:
     return false;
   }
 
+  /**
+   * @brief Calculates a guest RIP from the RIP the function was entered at
+   * This keeps the IR independent of where the guest code lives, so identical code at different RIPs generates identical IR
+   */
+  OrderedNode *GetRelocatedPC(uint64_t PC) {
+    return _Add(EntryRIP, _Constant(PC - Entry));
+  }
+
   OpDispatchBuilder();
 
   IRListView<false> ViewIR() { return IRListView<false>(&Data, &ListData); }
@@ -482,20 +490,21 @@ public:
     return _PhiValue(Value, Block, InvalidNode);
   }
 
-  void AddPhiValue(IR::IROp_Phi *Phi, OrderedNode *Value) {
+  void AddPhiValue(IRPair<IROp_Phi> Phi, OrderedNode *Value) {
     // Got to do some bookkeeping first
-    Value->AddUse();
+    AddArgUse(Value, Phi.Node);
     auto ValueIROp = Value->Op(Data.Begin())->C<IR::IROp_PhiValue>()->Value.GetNode(ListData.Begin())->Op(Data.Begin());
-    Phi->Header.Size = ValueIROp->Size;
-    Phi->Header.Elements = ValueIROp->Elements;
+    Phi.first->Header.Size = ValueIROp->Size;
+    Phi.first->Header.Elements = ValueIROp->Elements;
 
-    if (!Phi->PhiBegin.ID()) {
-      Phi->PhiBegin = Phi->PhiEnd = Value->Wrapped(ListData.Begin());
+    if (!Phi.first->PhiBegin.ID()) {
+      Phi.first->PhiBegin = Phi.first->PhiEnd = Value->Wrapped(ListData.Begin());
       return;
     }
-    auto PhiValueEndNode = Phi->PhiEnd.GetNode(ListData.Begin());
+    auto PhiValueEndNode = Phi.first->PhiEnd.GetNode(ListData.Begin());
     auto PhiValueEndOp = PhiValueEndNode->Op(Data.Begin())->CW<IR::IROp_PhiValue>();
     PhiValueEndOp->Next = Value->Wrapped(ListData.Begin());
+    Phi.first->PhiEnd = Value->Wrapped(ListData.Begin());
   }
 
   void SetJumpTarget(IR::IROp_Jump *Op, OrderedNode *Target) {
@@ -562,9 +571,11 @@ public:
   // This is fairly special in how it operates
   // Since the node is decoupled from the backing op then we can swap out the backing op without much overhead
   // This can potentially cause problems where multiple nodes are pointing to the same IROp
+  // The arguments of the old op lose a use and the arguments of the new op gain one
   OrderedNode *ReplaceAllUsesWith(OrderedNode *Node, IROp_Header *Op) {
     RemoveArgUses(Node);
     Node->Header.Value.SetOffset(Data.Begin(), reinterpret_cast<uintptr_t>(Op));
+    AddArgUses(Node);
     return Node;
   }
 
@@ -574,13 +585,103 @@ public:
   OrderedNode *ReplaceAllUsesWith(OrderedNode *Node, OrderedNode *NewNode) {
     RemoveArgUses(Node);
     Node->Header.Value.NodeOffset = NewNode->Header.Value.NodeOffset;
+    AddArgUses(Node);
     return Node;
   }
 
   void ReplaceAllUsesWithInclusive(OrderedNode *Node, OrderedNode *NewNode, IR::NodeWrapperIterator After, IR::NodeWrapperIterator End);
 
+  /**
+   * @name Def-use chains
+   *
+   * Use lists get built on demand the first time the users of a node are needed.
+   * From then on the mutation routines of the builder keep them in sync until the working list is reset or replaced.
+   * Like the use counts only the arguments ForEachUsedArg visits are tracked.
+   * @{ */
+  void BuildUseLists();
+  bool HasUseLists() const { return UseListsValid; }
+
+  /**
+   * @brief Calls Func with every argument of User that counts as a use
+   *
+   * These are the RA visible arguments, the value of a PhiValue and the PhiValues of a Phi.
+   * Block targets and the other list links aren't uses.
+   */
+  template<typename Func>
+  void ForEachUsedArg(OrderedNode *User, Func &&F) {
+    uintptr_t ListBegin = ListData.Begin();
+    uintptr_t DataBegin = Data.Begin();
+    FEXCore::IR::IROp_Header *IROp = User->Op(DataBegin);
+
+    switch (IROp->Op) {
+      case OP_PHI: {
+        auto Op = IROp->C<IR::IROp_Phi>();
+        if (!Op->PhiBegin.ID()) {
+          break;
+        }
+
+        for (auto Value = Op->PhiBegin;; ) {
+          OrderedNode *ValueNode = Value.GetNode(ListBegin);
+          F(ValueNode);
+          if (Value.ID() == Op->PhiEnd.ID()) {
+            break;
+          }
+          Value = ValueNode->Op(DataBegin)->C<IR::IROp_PhiValue>()->Next;
+        }
+        break;
+      }
+      case OP_PHIVALUE:
+        F(IROp->Args[0].GetNode(ListBegin));
+        break;
+      default: {
+        uint8_t NumArgs = IR::GetArgs(IROp->Op);
+        for (uint8_t i = 0; i < NumArgs; ++i) {
+          F(IROp->Args[i].GetNode(ListBegin));
+        }
+        break;
+      }
+    }
+  }
+
+  /**
+   * @brief Rewrites every argument that references Node to reference NewNode instead
+   *
+   * Unlike the ReplaceAllUsesWith variants this only touches the users of Node, so it costs O(uses) instead of a walk over the IR.
+   * NewNode must dominate every user of Node.
+   */
+  void RewriteUses(OrderedNode *Node, OrderedNode *NewNode);
+
+  /**
+   * @brief Calls Func with every node using Node as an argument
+   * A user that has Node as multiple arguments is visited once per argument
+   */
+  template<typename Func>
+  void ForEachUser(OrderedNode *Node, Func &&F) {
+    if (!UseListsValid) {
+      BuildUseLists();
+    }
+
+    uint32_t ID = Node->Wrapped(ListData.Begin()).ID();
+    if (ID >= UseListHeads.size()) {
+      return;
+    }
+
+    for (uint32_t Entry = UseListHeads[ID]; Entry != 0;) {
+      // Fetch the next entry first so Func is free to modify the uses of Node
+      uint32_t Next = UseEntries[Entry].Next;
+      F(GetNode(UseEntries[Entry].User));
+      Entry = Next;
+    }
+  }
+  /**  @} */
+
   void Remove(OrderedNode *Node);
 
+  /**
+   * @brief Moves an already linked node to directly before another node
+   * The node keeps all of its arguments so use counts don't change
+   */
+  void MoveBefore(OrderedNode *Node, OrderedNode *Before);
 
   void SetPackedRFLAG(bool Lower8, OrderedNode *Src);
   OrderedNode *GetPackedRFLAG(bool Lower8);
@@ -590,6 +691,7 @@ public:
     LogMan::Throw::A(rhs.ListData.BackingSize() <= ListData.BackingSize(), "Trying to take ownership of data that is too large");
     Data.CopyData(rhs.Data);
     ListData.CopyData(rhs.ListData);
+    UseListsValid = false;
     InvalidNode = rhs.InvalidNode;
     CurrentWriteCursor = rhs.CurrentWriteCursor;
     CodeBlocks = rhs.CodeBlocks;
@@ -668,6 +770,21 @@ public:
 
 private:
   void RemoveArgUses(OrderedNode *Node);
+  void AddArgUses(OrderedNode *Node);
+
+  // Every change to a use goes through these so the use count and the use list can't disagree
+  void AddArgUse(OrderedNode *Arg, OrderedNode *User);
+  void RemoveArgUse(OrderedNode *Arg, OrderedNode *User);
+
+  // Called by the generated op helpers once the arguments of a new op are set
+  void LinkArgUses(OrderedNode *User) {
+    if (UseListsValid) {
+      LinkArgUseLists(User);
+    }
+  }
+  void LinkArgUseLists(OrderedNode *User);
+  void LinkUse(uint32_t Node, uint32_t User);
+  void UnlinkUse(uint32_t Node, uint32_t User);
   bool DecodeFailure{false};
 
   OrderedNode *LoadSource(FEXCore::IR::RegisterClassType Class, FEXCore::X86Tables::DecodedOp const& Op, FEXCore::X86Tables::DecodedOperand const& Operand, uint32_t Flags, int8_t Align, bool LoadData = true, bool ForceLoad = false);
@@ -684,6 +801,12 @@ private:
   void SetRFLAG(OrderedNode *Value, unsigned BitOffset);
   OrderedNode *GetRFLAG(unsigned BitOffset);
 
+  /**
+   * @brief Byte offset the string ops move their pointers by after Count elements of Size bytes
+   * Negative when the direction flag is set
+   */
+  OrderedNode *GetStringPointerOffset(OrderedNode *Count, OrderedNode *DF, uint8_t Size);
+
   void GenerateFlags_ADC(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, OrderedNode *CF);
   void GenerateFlags_SBB(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2, OrderedNode *CF);
   void GenerateFlags_SUB(FEXCore::X86Tables::DecodedOp Op, OrderedNode *Res, OrderedNode *Src1, OrderedNode *Src2);
@@ -739,9 +862,25 @@ private:
 
   OrderedNode *InvalidNode;
   OrderedNode *CurrentCodeBlock{};
+
+  struct UseEntry {
+    uint32_t User; ///< Node ID of the user
+    uint32_t Next; ///< Next entry in the list, zero ends the list
+  };
+
+  // Use lists are singly linked lists of entries allocated linearly out of UseEntries, indexed by node ID
+  // They live outside of the IR allocators so IR copies and node IDs aren't affected by them
+  // Entry zero is reserved as the list terminator
+  bool UseListsValid{};
+  std::vector<uint32_t> UseListHeads;
+  std::vector<UseEntry> UseEntries;
+  uint32_t FreeUseEntries{};
+
   std::vector<OrderedNode*> CodeBlocks;
   bool Multiblock{};
   uint64_t Entry;
+  // RIP loaded by the function's prologue
+  OrderedNode *EntryRIP{};
 };
 
 void InstallOpcodeHandlers();
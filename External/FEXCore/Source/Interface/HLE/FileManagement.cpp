@@ -166,8 +166,10 @@ uint64_t FileManager::Open(const char *pathname, [[maybe_unused]] int flags, [[m
 }
 
 uint64_t FileManager::Close(int fd) {
-  int Result = ::close(fd);
+  // The fd can be handed out again as soon as it is closed, its name has to be gone before another open can record it
+  std::scoped_lock<std::mutex> lk(FDMutex);
   FDToNameMap.erase(fd);
+  int Result = ::close(fd);
   return Result;
 }
 
@@ -306,6 +308,7 @@ uint64_t FileManager::Openat([[maybe_unused]] int dirfs, const char *pathname, i
     }
   }
 
+  std::scoped_lock<std::mutex> lk(FDMutex);
   FDToNameMap[fd] = pathname;
   return fd;
 }
@@ -575,12 +578,13 @@ int32_t FileManager::FindHostFD(int fd) {
   return fd;
 }
 
-std::string *FileManager::FindFDName(int fd) {
+std::optional<std::string> FileManager::FindFDName(int fd) {
+  std::scoped_lock<std::mutex> lk(FDMutex);
   auto it = FDToNameMap.find(fd);
   if (it == FDToNameMap.end()) {
-    return nullptr;
+    return std::nullopt;
   }
-  return &it->second;
+  return it->second;
 }
 
 FD const* FileManager::GetFDBacking(int fd) {
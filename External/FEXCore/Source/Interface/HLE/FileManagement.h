@@ -1,5 +1,7 @@
 #pragma once
 #include <cstdint>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 #include <sys/stat.h>
@@ -121,7 +123,7 @@ public:
 
   int32_t FindHostFD(int fd);
 
-  std::string *FindFDName(int fd);
+  std::optional<std::string> FindFDName(int fd);
   FD const* GetFDBacking(int fd);
   int32_t DupFD(int prevFD, int newFD);
 
@@ -132,6 +134,8 @@ private:
   FEXCore::Context::Context *CTX;
   FEXCore::EmulatedFile::EmulatedFDManager EmuFD;
 
+  // Syscalls from different threads open and close fds concurrently
+  std::mutex FDMutex;
   std::unordered_map<int32_t, std::string> FDToNameMap;
   std::string Filename;
   std::string GetEmulatedPath(const char *pathname);
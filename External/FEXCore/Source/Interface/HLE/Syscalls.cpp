@@ -113,6 +113,13 @@ void SyscallHandler::Strace(FEXCore::HLE::SyscallArguments *Args, uint64_t Ret)
       Args->Argument[3],
       Ret);
     break;
+  case SYSCALL_MADVISE:
+    LogMan::Msg::D("madvise(0x%lx, 0x%lx, %ld) = %ld",
+      Args->Argument[1],
+      Args->Argument[2],
+      Args->Argument[3],
+      Ret);
+    break;
   case SYSCALL_SHMGET:
     LogMan::Msg::D("shmget(0x%lx, 0x%lx, 0x%lx) = %ld",
       Args->Argument[1],
@@ -495,6 +502,31 @@ void SyscallHandler::DefaultProgramBreak(FEXCore::Core::InternalThreadState *Thr
   DefaultProgramBreakAddress = Addr;
 }
 
+bool SyscallHandler::AllocateMMAPRange(uint64_t Size, uint64_t *Offset) {
+  uint64_t End = CTX->MemoryMapper.GetSHMSize();
+
+  // Search from the cursor first, then wrap around to reuse any holes that were left behind it
+  if (!CTX->MemoryMapper.FindFreeRange(LastMMAP, End, Size, Offset) &&
+      !CTX->MemoryMapper.FindFreeRange(MMAPBase, std::min(LastMMAP + Size, End), Size, Offset)) {
+    return false;
+  }
+
+  LastMMAP = *Offset + Size;
+  return true;
+}
+
+void SyscallHandler::UnmapMMAPRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Offset, uint64_t Size) {
+  CTX->MemoryMapper.UnmapRegion(Offset, Size);
+
+  // The range can get mapped again with different code in it
+  uint64_t GuestBase = UnifiedMemory ? CTX->MemoryMapper.GetBaseOffset<uint64_t>(0) : 0;
+  CTX->InvalidateGuestCodeRange(Thread, Offset + GuestBase, Size);
+
+  if (Offset >= MMAPBase && Offset < LastMMAP) {
+    LastMMAP = Offset;
+  }
+}
+
 SyscallHandler::SyscallHandler(FEXCore::Context::Context *ctx)
   : CTX {ctx}
   , UnifiedMemory {CTX->Config.UnifiedMemory}
@@ -519,7 +551,6 @@ void *SyscallHandler::GetPointerSizeCheck(uint64_t Offset, uint64_t Size) {
 
 uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args) {
   uint64_t Result = 0;
-  std::scoped_lock<std::mutex> lk(SyscallMutex);
 
   switch (Args->Argument[0]) {
   case SYSCALL_UNAME: {
@@ -541,6 +572,7 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
   }
   // Memory management
   case SYSCALL_BRK: {
+    std::scoped_lock<std::mutex> lk(BRKMutex);
     if (Args->Argument[1] == 0) { // Just wants to get the location of the program break atm
       if (DataSpace == 0) {
         // XXX: We need to setup our default BRK space first
@@ -565,10 +597,11 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
   break;
   }
   case SYSCALL_MMAP: {
+    std::scoped_lock<std::mutex> lk(MMAPMutex);
     int Flags = Args->Argument[4];
     int GuestFD = static_cast<int32_t>(Args->Argument[5]);
 
-    uint64_t Base = AlignDown(LastMMAP, PAGE_SIZE);
+    uint64_t Base{};
     uint64_t Size = AlignUp(Args->Argument[2], PAGE_SIZE);
     uint64_t FileSizeToUse = Args->Argument[2];
     uint64_t Prot = Args->Argument[3];
@@ -577,17 +610,15 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
       break;
     }
 
-    if (UnifiedMemory) {
-      // If we are running unified memory then we want to be after our base
-      // This makes code page loading less of a burden
-      Base += CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
-    }
-
     if (Flags & MAP_FIXED) {
       Base = Args->Argument[1];
 
       void *HostPtr = GetPointerSizeCheck(Base, FileSizeToUse);
-      if (!HostPtr) {
+      if (UnifiedMemory) {
+        uint64_t Offset = Base - CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
+        CTX->MemoryMapper.AddRegion(FEXCore::Memory::MemRegion{HostPtr, Offset, Size});
+      }
+      else if (!HostPtr) {
         HostPtr = CTX->MapRegion(Thread, Base, Size, true);
         if (GuestFD != -1) {
           auto Name = FM.FindFDName(GuestFD);
@@ -608,20 +639,34 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
         mmap(HostPtr, Size, Prot, Flags, GuestFD, Args->Argument[6]);
       }
 
+      // Fixed mappings replace whatever was in the range, including code that was compiled from it
+      CTX->InvalidateGuestCodeRange(Thread, Base, Size);
+
       Result = Base;
     }
     else {
+      if (!AllocateMMAPRange(Size, &Base)) {
+        Result = -ENOMEM;
+        break;
+      }
+
       // XXX: MMAP should map memory regions for all threads
-      void *HostPtr = GetPointerSizeCheck(Base, FileSizeToUse);
-      if (!HostPtr) {
-        HostPtr = CTX->MapRegion(Thread, Base, Size, true);
+      void *HostPtr{};
+      if (UnifiedMemory) {
+        // If we are running unified memory then we want to be after our base
+        // This makes code page loading less of a burden
+        HostPtr = CTX->MemoryMapper.GetBaseOffset<void*>(Base);
+        CTX->MemoryMapper.AddRegion(FEXCore::Memory::MemRegion{HostPtr, Base, Size});
+        Base += CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
       }
       else {
-        if (GuestFD != -1) {
-          auto Name = FM.FindFDName(GuestFD);
-          if (Name) {
-            LogMan::Msg::D("Mapping File to [0x%lx, 0x%lx) -> '%s' -> %p", Base, Base + Size, Name->c_str(), HostPtr);
-          }
+        HostPtr = CTX->MapRegion(Thread, Base, Size, true);
+      }
+
+      if (GuestFD != -1) {
+        auto Name = FM.FindFDName(GuestFD);
+        if (Name) {
+          LogMan::Msg::D("Mapping File to [0x%lx, 0x%lx) -> '%s' -> %p", Base, Base + Size, Name->c_str(), HostPtr);
         }
       }
 
@@ -633,10 +678,10 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
         }
       }
       else {
-        mmap(HostPtr, Size, Prot, Flags, GuestFD, Args->Argument[6]);
+        // The range is already backed by zeroed guest memory, only the protection needs to match
+        mprotect(HostPtr, Size, Prot);
       }
 
-      LastMMAP += Size;
       Result = Base;
     }
   break;
@@ -824,7 +869,11 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
     Thread->State.RunningEvents.ShouldStop = true;
     if (Thread->State.ThreadManager.clear_tid) {
       Futex *futex = GetFutex(Thread->State.ThreadManager.child_tid);
-      futex->Addr->store(0);
+      {
+        // Waiters check the value under the futex's mutex, taking it here means the wakeup can't land between their check and wait
+        std::scoped_lock<std::mutex> lk(futex->Mutex);
+        futex->Addr->store(0);
+      }
       futex->cv.notify_all();
     }
   break;
@@ -853,18 +902,21 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
         Futex *futex = GetFutex(Args->Argument[1]);
 
         if (!futex) {
-          futex = new Futex{}; // XXX: Definitely a memory leak. When should we free this?
-          futex->Addr = GetPointer<std::atomic<uint32_t>*>(Args->Argument[1]);
-          futex->Val = Args->Argument[3];
-          EmplaceFutex(Args->Argument[1], futex);
+          Futex *NewFutex = new Futex{}; // XXX: Definitely a memory leak. When should we free this?
+          NewFutex->Addr = GetPointer<std::atomic<uint32_t>*>(Args->Argument[1]);
+          NewFutex->Val = Args->Argument[3];
+          futex = TryEmplaceFutex(Args->Argument[1], NewFutex);
+          if (futex != NewFutex) {
+            delete NewFutex;
+          }
         }
+        std::unique_lock<std::mutex> lk(futex->Mutex);
         if (futex->Addr->load() != futex->Val) {
           // Immediate check can return EAGAIN
           Result = EAGAIN;
         }
         else
         {
-          std::unique_lock<std::mutex> lk(futex->Mutex);
           futex->Waiters++;
           futex->cv.wait(lk, [futex] { return futex->Addr->load() != futex->Val; });
           futex->Waiters--;
@@ -878,6 +930,8 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
           Result = 0;
           break;
         }
+        // Serializes with waiters that checked the value but haven't started waiting yet
+        { std::scoped_lock<std::mutex> lk(futex->Mutex); }
         if (Args->Argument[3] == INT_MAX) {
           Result = futex->Waiters;
           futex->cv.notify_all();
@@ -900,6 +954,7 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
           break;
         }
 
+        { std::scoped_lock<std::mutex> lk(futex->Mutex); }
         Result = futex->Waiters;
         futex->cv.notify_all();
         break;
@@ -1175,17 +1230,143 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
   }
   break;
   case SYSCALL_MREMAP: {
-    Result = (uint64_t)mremap(GetPointer(Args->Argument[1]),
-      Args->Argument[2],
-      Args->Argument[3],
-      Args->Argument[4],
-      GetPointer(Args->Argument[5]));
+    std::scoped_lock<std::mutex> lk(MMAPMutex);
+    uint64_t GuestBase = UnifiedMemory ? CTX->MemoryMapper.GetBaseOffset<uint64_t>(0) : 0;
+    uint64_t OldOffset = Args->Argument[1] - GuestBase;
+    uint64_t OldSize = AlignUp(Args->Argument[2], PAGE_SIZE);
+    uint64_t NewSize = AlignUp(Args->Argument[3], PAGE_SIZE);
+    uint64_t Flags = Args->Argument[4];
+
+    if ((OldOffset & (PAGE_SIZE - 1)) || OldSize == 0 || NewSize == 0) {
+      Result = -EINVAL;
+      break;
+    }
+
+    if (!CTX->MemoryMapper.IsRangeMapped(OldOffset, OldSize)) {
+      Result = -EFAULT;
+      break;
+    }
+
+    if (Flags & MREMAP_FIXED) {
+      // XXX: Moving to a guest chosen address isn't supported yet
+      Result = -EINVAL;
+      break;
+    }
+
+    if (NewSize == OldSize) {
+      Result = OldOffset + GuestBase;
+      break;
+    }
+
+    if (NewSize < OldSize) {
+      UnmapMMAPRange(Thread, OldOffset + NewSize, OldSize - NewSize);
+      Result = OldOffset + GuestBase;
+      break;
+    }
+
+    // Grow in place if nothing is mapped after the region
+    uint64_t GrowOffset{};
+    if (CTX->MemoryMapper.FindFreeRange(OldOffset + OldSize, OldOffset + NewSize, NewSize - OldSize, &GrowOffset)) {
+      if (UnifiedMemory) {
+        CTX->MemoryMapper.AddRegion(FEXCore::Memory::MemRegion{CTX->MemoryMapper.GetBaseOffset<void*>(GrowOffset), GrowOffset, NewSize - OldSize});
+      }
+      else {
+        CTX->MapRegion(Thread, GrowOffset, NewSize - OldSize, true);
+      }
+      Result = OldOffset + GuestBase;
+      break;
+    }
+
+    if (!(Flags & MREMAP_MAYMOVE)) {
+      Result = -ENOMEM;
+      break;
+    }
+
+    uint64_t NewOffset{};
+    if (!AllocateMMAPRange(NewSize, &NewOffset)) {
+      Result = -ENOMEM;
+      break;
+    }
+
+    // Guest memory lives at fixed offsets in the SHM, so the contents get copied rather than remapped
+    void *NewPtr{};
+    if (UnifiedMemory) {
+      NewPtr = CTX->MemoryMapper.GetBaseOffset<void*>(NewOffset);
+      CTX->MemoryMapper.AddRegion(FEXCore::Memory::MemRegion{NewPtr, NewOffset, NewSize});
+    }
+    else {
+      NewPtr = CTX->MapRegion(Thread, NewOffset, NewSize, true);
+    }
+
+    memcpy(NewPtr, CTX->MemoryMapper.GetBaseOffset<void*>(OldOffset), OldSize);
+    UnmapMMAPRange(Thread, OldOffset, OldSize);
+    Result = NewOffset + GuestBase;
+    break;
+  }
+  case SYSCALL_MUNMAP: {
+    std::scoped_lock<std::mutex> lk(MMAPMutex);
+    uint64_t Offset = Args->Argument[1] - (UnifiedMemory ? CTX->MemoryMapper.GetBaseOffset<uint64_t>(0) : 0);
+    uint64_t Size = AlignUp(Args->Argument[2], PAGE_SIZE);
+
+    if ((Offset & (PAGE_SIZE - 1)) || Size == 0) {
+      Result = -EINVAL;
+      break;
+    }
+
+    UnmapMMAPRange(Thread, Offset, Size);
+    Result = 0;
     break;
   }
   case SYSCALL_MINCORE: {
-    Result = mincore(GetPointer(Args->Argument[1]),
+    void *HostPtr = GetPointer(Args->Argument[1]);
+    if (!HostPtr) {
+      Result = -ENOMEM;
+      break;
+    }
+
+    int HostResult = mincore(HostPtr,
       Args->Argument[2],
       GetPointer<unsigned char*>(Args->Argument[3]));
+    Result = HostResult == -1 ? -errno : HostResult;
+  break;
+  }
+  case SYSCALL_MADVISE: {
+    uint64_t Addr = Args->Argument[1];
+    uint64_t Length = AlignUp(Args->Argument[2], PAGE_SIZE);
+    int Advice = Args->Argument[3];
+
+    if (Addr & (PAGE_SIZE - 1)) {
+      Result = -EINVAL;
+      break;
+    }
+
+    void *HostPtr = GetPointer(Addr);
+    if (!HostPtr) {
+      Result = -ENOMEM;
+      break;
+    }
+
+    switch (Advice) {
+    case MADV_DONTNEED:
+    case MADV_FREE:
+    case MADV_REMOVE:
+      // Most guest memory is a shared mapping of the SHM, where MADV_DONTNEED keeps the contents around
+      // Removing the range frees the SHM pages and reads back as zero like the guest expects
+      // Anything that isn't shared, like private file mappings, needs MADV_DONTNEED instead
+      Result = 0;
+      if (madvise(HostPtr, Length, MADV_REMOVE) != 0 &&
+          madvise(HostPtr, Length, MADV_DONTNEED) != 0) {
+        Result = -errno;
+      }
+
+      CTX->InvalidateGuestCodeRange(Thread, Addr, Length);
+      break;
+    default: {
+      int HostResult = madvise(HostPtr, Length, Advice);
+      Result = HostResult == -1 ? -errno : HostResult;
+      break;
+    }
+    }
   break;
   }
   case SYSCALL_SHMGET: {
@@ -1268,7 +1449,8 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
   break;
   }
   case SYSCALL_FADVISE64: {
-    Result = posix_fadvise(Args->Argument[1], Args->Argument[2], Args->Argument[3], Args->Argument[4]);
+    // Returns the error directly rather than through errno
+    Result = -posix_fadvise(Args->Argument[1], Args->Argument[2], Args->Argument[3], Args->Argument[4]);
   break;
   }
   case SYSCALL_SET_TID_ADDRESS: {
@@ -1423,7 +1605,6 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
   case SYSCALL_RT_SIGPROCMASK:
   case SYSCALL_EXIT_GROUP:
   case SYSCALL_TGKILL:
-  case SYSCALL_MUNMAP:
     Result = 0;
   break;
   default:
@@ -1437,4 +1618,50 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::InternalThreadState *Threa
 #endif
   return Result;
 }
+
+SyscallHandler::DirectSyscallHandler SyscallHandler::GetDirectHandler(uint64_t Syscall) {
+  switch (Syscall) {
+  case SYSCALL_GETTID:
+    return []([[maybe_unused]] SyscallHandler *Handler, FEXCore::Core::InternalThreadState *Thread, [[maybe_unused]] FEXCore::HLE::SyscallArguments *Args) -> uint64_t {
+      uint64_t Result = Thread->State.ThreadManager.GetTID();
+#ifdef DEBUG_STRACE
+      Handler->Strace(Args, Result);
+#endif
+      return Result;
+    };
+  case SYSCALL_GETPID:
+    return []([[maybe_unused]] SyscallHandler *Handler, FEXCore::Core::InternalThreadState *Thread, [[maybe_unused]] FEXCore::HLE::SyscallArguments *Args) -> uint64_t {
+      uint64_t Result = Thread->State.ThreadManager.GetPID();
+#ifdef DEBUG_STRACE
+      Handler->Strace(Args, Result);
+#endif
+      return Result;
+    };
+  case SYSCALL_WRITE:
+    // Writes go straight to the host fd, there is no handler state to protect
+    return [](SyscallHandler *Handler, [[maybe_unused]] FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args) -> uint64_t {
+      uint64_t Result = Handler->FM.Write(Args->Argument[1],
+        Handler->GetPointer(Args->Argument[2]),
+        Args->Argument[3]);
+#ifdef DEBUG_STRACE
+      Handler->Strace(Args, Result);
+#endif
+      return Result;
+    };
+  case SYSCALL_CLOCK_GETTIME:
+    return [](SyscallHandler *Handler, [[maybe_unused]] FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args) -> uint64_t {
+      timespec *ClockResult = Handler->GetPointer<timespec*>(Args->Argument[2]);
+      uint64_t Result = clock_gettime(Args->Argument[1], ClockResult);
+#ifdef DEBUG_TIME
+      memset(ClockResult, 0, sizeof(timespec));
+#endif
+#ifdef DEBUG_STRACE
+      Handler->Strace(Args, Result);
+#endif
+      return Result;
+    };
+  default:
+    return nullptr;
+  }
+}
 }
@@ -40,6 +40,7 @@ enum Syscalls {
   SYSCALL_SCHED_YIELD     = 24,  ///< __NR_sched_yield
   SYSCALL_MREMAP          = 25,  ///< __NR_mremap
   SYSCALL_MINCORE         = 27,  ///< __NR_mincore
+  SYSCALL_MADVISE         = 28,  ///< __NR_madvise
   SYSCALL_SHMGET          = 29,  ///< __NR_shmget
   SYSCALL_SHMAT           = 30,  ///< __NR_shmat
   SYSCALL_SHMCTL          = 31,  ///< __NR_shmctl
@@ -128,9 +129,20 @@ struct Futex {
 // #define DEBUG_STRACE
 class SyscallHandler final {
 public:
+  using DirectSyscallHandler = uint64_t(*)(SyscallHandler *Handler, FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args);
+
   SyscallHandler(FEXCore::Context::Context *ctx);
   uint64_t HandleSyscall(FEXCore::Core::InternalThreadState *Thread, FEXCore::HLE::SyscallArguments *Args);
 
+  /**
+   * @brief Returns a specialized handler for a syscall number known at compile time
+   *
+   * These handlers skip the syscall dispatch, so only syscalls that don't touch shared handler state get one.
+   *
+   * @return nullptr if the syscall needs to go through HandleSyscall
+   */
+  static DirectSyscallHandler GetDirectHandler(uint64_t Syscall);
+
   // XXX: This leaks memory.
   // Need to know when to delete futexes
   void EmplaceFutex(uint64_t Addr, Futex *futex) {
@@ -138,6 +150,12 @@ public:
     Futexes[Addr] = futex;
   }
 
+  // Returns the futex that ends up tracked for Addr, which is an existing one if another thread added it first
+  Futex *TryEmplaceFutex(uint64_t Addr, Futex *futex) {
+    std::scoped_lock<std::mutex> lk(FutexMutex);
+    return Futexes.try_emplace(Addr, futex).first->second;
+  }
+
   Futex *GetFutex(uint64_t Addr) {
     std::scoped_lock<std::mutex> lk (FutexMutex);
     auto it = Futexes.find(Addr);
@@ -163,15 +181,28 @@ private:
   // Futex management
   std::unordered_map<uint64_t, Futex*> Futexes;
   std::mutex FutexMutex;
-  std::mutex SyscallMutex;
 
   // BRK management
+  std::mutex BRKMutex;
   uint64_t DataSpace {};
   uint64_t DataSpaceSize {};
   uint64_t DefaultProgramBreakAddress {};
 
   // MMap management
-  uint64_t LastMMAP = 0xd000'0000;
+  static constexpr uint64_t MMAPBase = 0xd000'0000;
+  // Held across finding a range and mapping it so threads can't be handed the same range
+  std::mutex MMAPMutex;
+  // Next-fit cursor for non-fixed mappings, moved back when a range below it gets unmapped
+  uint64_t LastMMAP = MMAPBase;
+
+  /**
+   * @brief Finds guest space for a non-fixed mapping and moves the cursor past it
+   *
+   * @return true if there was enough space, Offset is set to the range's guest offset
+   */
+  bool AllocateMMAPRange(uint64_t Size, uint64_t *Offset);
+  // Also drops any code that was compiled from the range
+  void UnmapMMAPRange(FEXCore::Core::InternalThreadState *Thread, uint64_t Offset, uint64_t Size);
 
 #ifdef DEBUG_STRACE
   void Strace(FEXCore::HLE::SyscallArguments *Args, uint64_t Ret);
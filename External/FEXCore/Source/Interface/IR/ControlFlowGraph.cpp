@@ -0,0 +1,290 @@
+#include "Interface/IR/ControlFlowGraph.h"
+
+#include <FEXCore/IR/IntrusiveIRList.h>
+#include <LogManager.h>
+
+#include <algorithm>
+
+namespace FEXCore::IR {
+
+void ControlFlowGraph::Calculate(IRListView<false> *IR) {
+  Blocks.clear();
+  ReversePostOrder.clear();
+  Loops.clear();
+  BlockIDToIndex.clear();
+
+  CalculateEdges(IR);
+  CalculateDominators();
+  CalculateLoops();
+}
+
+uint32_t ControlFlowGraph::GetBlockIndex(uint32_t CodeBlockID) const {
+  auto it = BlockIDToIndex.find(CodeBlockID);
+  LogMan::Throw::A(it != BlockIDToIndex.end(), "%%ssa%d isn't a code block", CodeBlockID);
+  return it->second;
+}
+
+bool ControlFlowGraph::Dominates(uint32_t Dominator, uint32_t Block) const {
+  if (Blocks[Block].RPONumber == InvalidBlock) {
+    // Unreachable blocks are only dominated by themselves
+    return Dominator == Block;
+  }
+
+  // Walk up the dominator tree until we hit the entry block
+  while (Block != InvalidBlock) {
+    if (Block == Dominator) {
+      return true;
+    }
+    Block = Blocks[Block].IDom;
+  }
+
+  return false;
+}
+
+bool ControlFlowGraph::IsBlockInLoop(uint32_t Loop, uint32_t Block) const {
+  auto const &LoopBlocks = Loops[Loop].Blocks;
+  return std::binary_search(LoopBlocks.begin(), LoopBlocks.end(), Block);
+}
+
+void ControlFlowGraph::CalculateEdges(IRListView<false> *IR) {
+  uintptr_t ListBegin = IR->GetListData();
+  uintptr_t DataBegin = IR->GetData();
+
+  auto Begin = IR->begin();
+  auto Op = Begin();
+
+  OrderedNode *RealNode = Op->GetNode(ListBegin);
+  auto HeaderOp = RealNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+  LogMan::Throw::A(HeaderOp->Header.Op == OP_IRHEADER, "First op wasn't IRHeader");
+
+  // Number the blocks first so branch targets can be resolved in a single walk
+  OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+  while (1) {
+    auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    LogMan::Throw::A(BlockIROp->Header.Op == OP_CODEBLOCK, "IR type failed to be a code block");
+
+    BlockIDToIndex[BlockNode->Wrapped(ListBegin).ID()] = Blocks.size();
+    Blocks.emplace_back(BlockInfo{BlockNode});
+
+    if (BlockIROp->Next.ID() == 0) {
+      break;
+    } else {
+      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+    }
+  }
+
+  auto AddEdge = [&](uint32_t From, OrderedNodeWrapper Target) {
+    uint32_t To = GetBlockIndex(Target.ID());
+    auto &Successors = Blocks[From].Successors;
+    if (std::find(Successors.begin(), Successors.end(), To) != Successors.end()) {
+      // CondJump with both targets being the same block
+      return;
+    }
+    Successors.emplace_back(To);
+    Blocks[To].Predecessors.emplace_back(From);
+  };
+
+  for (uint32_t i = 0; i < Blocks.size(); ++i) {
+    auto BlockIROp = Blocks[i].Node->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+
+    // We grab these nodes this way so we can iterate easily
+    auto CodeBegin = IR->at(BlockIROp->Begin);
+    auto CodeLast = IR->at(BlockIROp->Last);
+
+    while (1) {
+      auto CodeOp = CodeBegin();
+      OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+      auto IROp = CodeNode->Op(DataBegin);
+
+      switch (IROp->Op) {
+        case IR::OP_CONDJUMP: {
+          AddEdge(i, IROp->Args[1]);
+          AddEdge(i, IROp->Args[2]);
+          break;
+        }
+        case IR::OP_JUMP: {
+          AddEdge(i, IROp->Args[0]);
+          break;
+        }
+        default: break;
+      }
+
+      // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+  }
+}
+
+void ControlFlowGraph::CalculateDominators() {
+  // Iterative post order walk from the entry block
+  std::vector<uint32_t> PostOrder;
+  std::vector<bool> Visited(Blocks.size());
+  std::vector<std::pair<uint32_t, uint32_t>> Stack;
+
+  PostOrder.reserve(Blocks.size());
+  Stack.emplace_back(0, 0);
+  Visited[0] = true;
+
+  while (!Stack.empty()) {
+    uint32_t Block = Stack.back().first;
+    uint32_t NextSuccessor = Stack.back().second;
+    if (NextSuccessor < Blocks[Block].Successors.size()) {
+      ++Stack.back().second;
+      uint32_t Successor = Blocks[Block].Successors[NextSuccessor];
+      if (!Visited[Successor]) {
+        Visited[Successor] = true;
+        Stack.emplace_back(Successor, 0);
+      }
+    }
+    else {
+      PostOrder.emplace_back(Block);
+      Stack.pop_back();
+    }
+  }
+
+  ReversePostOrder.assign(PostOrder.rbegin(), PostOrder.rend());
+  for (uint32_t i = 0; i < ReversePostOrder.size(); ++i) {
+    Blocks[ReversePostOrder[i]].RPONumber = i;
+  }
+
+  // "A Simple, Fast Dominance Algorithm" - Cooper, Harvey, Kennedy
+  // The entry block temporarily dominates itself so the intersection walk terminates
+  auto Intersect = [&](uint32_t LHS, uint32_t RHS) {
+    while (LHS != RHS) {
+      while (Blocks[LHS].RPONumber > Blocks[RHS].RPONumber) {
+        LHS = Blocks[LHS].IDom;
+      }
+      while (Blocks[RHS].RPONumber > Blocks[LHS].RPONumber) {
+        RHS = Blocks[RHS].IDom;
+      }
+    }
+    return LHS;
+  };
+
+  Blocks[0].IDom = 0;
+  bool Changed = true;
+  while (Changed) {
+    Changed = false;
+    for (uint32_t i = 1; i < ReversePostOrder.size(); ++i) {
+      uint32_t Block = ReversePostOrder[i];
+      uint32_t NewIDom = InvalidBlock;
+
+      for (auto Pred : Blocks[Block].Predecessors) {
+        if (Blocks[Pred].IDom == InvalidBlock) {
+          // Not processed yet or unreachable
+          continue;
+        }
+
+        NewIDom = NewIDom == InvalidBlock ? Pred : Intersect(Pred, NewIDom);
+      }
+
+      if (Blocks[Block].IDom != NewIDom) {
+        Blocks[Block].IDom = NewIDom;
+        Changed = true;
+      }
+    }
+  }
+  Blocks[0].IDom = InvalidBlock;
+}
+
+void ControlFlowGraph::CalculateLoops() {
+  std::unordered_map<uint32_t, uint32_t> HeaderToLoop;
+  std::vector<std::vector<bool>> LoopMembers;
+  std::vector<uint32_t> WorkList;
+
+  for (auto Block : ReversePostOrder) {
+    for (auto Successor : Blocks[Block].Successors) {
+      if (!Dominates(Successor, Block)) {
+        continue;
+      }
+
+      // Back-edge from Block to the loop header Successor
+      // Back-edges sharing a header share a loop
+      auto LoopIt = HeaderToLoop.try_emplace(Successor, Loops.size());
+      if (LoopIt.second) {
+        Loops.emplace_back(LoopInfo{Successor});
+        LoopMembers.emplace_back(Blocks.size());
+        LoopMembers.back()[Successor] = true;
+      }
+
+      uint32_t LoopIndex = LoopIt.first->second;
+      auto &Members = LoopMembers[LoopIndex];
+      Loops[LoopIndex].Latches.emplace_back(Block);
+
+      // Walk backwards from the latch until we hit the header
+      if (!Members[Block]) {
+        Members[Block] = true;
+        WorkList.emplace_back(Block);
+      }
+
+      while (!WorkList.empty()) {
+        uint32_t Current = WorkList.back();
+        WorkList.pop_back();
+        for (auto Pred : Blocks[Current].Predecessors) {
+          if (!Members[Pred] && Blocks[Pred].RPONumber != InvalidBlock) {
+            Members[Pred] = true;
+            WorkList.emplace_back(Pred);
+          }
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < Loops.size(); ++i) {
+    for (uint32_t Block = 0; Block < Blocks.size(); ++Block) {
+      if (LoopMembers[i][Block]) {
+        Loops[i].Blocks.emplace_back(Block);
+      }
+    }
+  }
+
+  // Natural loops with different headers are either disjoint or nested
+  // Sorting by size puts inner loops before the loops that contain them
+  std::stable_sort(Loops.begin(), Loops.end(), [](LoopInfo const &LHS, LoopInfo const &RHS) {
+    return LHS.Blocks.size() < RHS.Blocks.size();
+  });
+
+  for (uint32_t i = 0; i < Loops.size(); ++i) {
+    auto &Loop = Loops[i];
+
+    // The smallest loop that contains our header is our parent
+    for (uint32_t j = i + 1; j < Loops.size(); ++j) {
+      if (IsBlockInLoop(j, Loop.Header)) {
+        Loop.Parent = j;
+        break;
+      }
+    }
+
+    for (auto Block : Loop.Blocks) {
+      if (Blocks[Block].Loop == InvalidLoop) {
+        Blocks[Block].Loop = i;
+      }
+    }
+
+    uint32_t Preheader = InvalidBlock;
+    uint32_t OutsidePredecessors = 0;
+    for (auto Pred : Blocks[Loop.Header].Predecessors) {
+      if (!IsBlockInLoop(i, Pred)) {
+        Preheader = Pred;
+        ++OutsidePredecessors;
+      }
+    }
+
+    if (OutsidePredecessors == 1 && Blocks[Preheader].Successors.size() == 1) {
+      Loop.Preheader = Preheader;
+    }
+  }
+
+  // Parents are always after their children
+  for (size_t i = Loops.size(); i > 0; --i) {
+    auto &Loop = Loops[i - 1];
+    if (Loop.Parent != InvalidLoop) {
+      Loop.Depth = Loops[Loop.Parent].Depth + 1;
+    }
+  }
+}
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <FEXCore/IR/IR.h>
+
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+namespace FEXCore::IR {
+template<bool>
+class IRListView;
+
+/**
+ * @brief Control flow analysis over the code blocks of an IR list
+ *
+ * Blocks are numbered in the order they are linked in the IR's block list.
+ * Calculates predecessors and successors, the dominator tree and the natural loops of the CFG.
+ *
+ * This is a snapshot of the IR. Passes that change control flow need to recalculate it.
+ * Moving non-branch ops between blocks doesn't invalidate it.
+ */
+class ControlFlowGraph final {
+public:
+  static constexpr uint32_t InvalidBlock = ~0U;
+  static constexpr uint32_t InvalidLoop = ~0U;
+
+  struct BlockInfo {
+    OrderedNode *Node;
+    // Immediate dominator. InvalidBlock for the entry block and unreachable blocks
+    uint32_t IDom {InvalidBlock};
+    // Innermost loop this block belongs to
+    uint32_t Loop {InvalidLoop};
+    // Position of this block in the reverse post order. InvalidBlock if unreachable
+    uint32_t RPONumber {InvalidBlock};
+    std::vector<uint32_t> Predecessors;
+    std::vector<uint32_t> Successors;
+  };
+
+  struct LoopInfo {
+    uint32_t Header;
+    // Enclosing loop, InvalidLoop if this is an outermost loop
+    uint32_t Parent {InvalidLoop};
+    // Outermost loops have a depth of 1
+    uint32_t Depth {1};
+    // Single predecessor of the header from outside of the loop that only flows in to the header
+    // InvalidBlock if the loop doesn't have one
+    uint32_t Preheader {InvalidBlock};
+    // All blocks of the loop including the header, sorted by block index
+    std::vector<uint32_t> Blocks;
+    // Blocks inside of the loop that branch back to the header
+    std::vector<uint32_t> Latches;
+  };
+
+  void Calculate(IRListView<false> *IR);
+
+  size_t GetBlockCount() const { return Blocks.size(); }
+  BlockInfo const &GetBlock(uint32_t Block) const { return Blocks[Block]; }
+
+  /**
+   * @brief Maps a CodeBlock node ID to its block index
+   */
+  uint32_t GetBlockIndex(uint32_t CodeBlockID) const;
+
+  std::vector<uint32_t> const &GetReversePostOrder() const { return ReversePostOrder; }
+
+  /**
+   * @brief Loops sorted so inner loops are always before the loops that enclose them
+   */
+  std::vector<LoopInfo> const &GetLoops() const { return Loops; }
+
+  bool Dominates(uint32_t Dominator, uint32_t Block) const;
+  bool IsBlockInLoop(uint32_t Loop, uint32_t Block) const;
+
+private:
+  std::vector<BlockInfo> Blocks;
+  std::vector<uint32_t> ReversePostOrder;
+  std::vector<LoopInfo> Loops;
+  std::unordered_map<uint32_t, uint32_t> BlockIDToIndex;
+
+  void CalculateEdges(IRListView<false> *IR);
+  void CalculateDominators();
+  void CalculateLoops();
+};
+
+}
@@ -1,34 +1,105 @@
 #include "Interface/IR/Passes.h"
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 #include "Interface/IR/PassManager.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include <FEXCore/Debug/InternalThreadState.h>
+
+#include <chrono>
 
 namespace FEXCore::IR {
 
+static uint64_t GetLiveNodeCount(OpDispatchBuilder *Disp) {
+  auto CurrentIR = Disp->ViewIR();
+  uintptr_t ListBegin = CurrentIR.GetListData();
+  uintptr_t DataBegin = CurrentIR.GetData();
+
+  auto Begin = CurrentIR.begin();
+  auto HeaderOp = Begin()->GetNode(ListBegin)->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+
+  uint64_t Count = 0;
+  OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+  while (1) {
+    auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+
+    // We grab these nodes this way so we can iterate easily
+    auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+    auto CodeLast = CurrentIR.at(BlockIROp->Last);
+    while (1) {
+      ++Count;
+
+      // CodeLast is inclusive. So we still need to count the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+
+    if (BlockIROp->Next.ID() == 0) {
+      break;
+    }
+    BlockNode = BlockIROp->Next.GetNode(ListBegin);
+  }
+
+  return Count;
+}
+
 void PassManager::AddDefaultPasses() {
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateContextLoadStoreElimination()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateConstProp()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateRedundantFlagCalculationEliminination()));
-  // Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateDeadFlagCalculationEliminination()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateSyscallOptimization()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreatePassDeadCodeElimination()));
+  InsertPass(CreateContextLoadStoreElimination(), "ContextLoadStoreElimination");
+  InsertPass(CreateConstProp(), "ConstProp");
+  InsertPass(CreateMemoryLoadStoreElimination(), "MemoryLoadStoreElimination");
+  InsertPass(CreateRedundantFlagCalculationEliminination(), "RedundantFlagCalculationEliminination");
+  // InsertPass(CreateDeadFlagCalculationEliminination(), "DeadFlagCalculationEliminination");
+  InsertPass(CreateSyscallOptimization(), "SyscallOptimization");
+  InsertPass(CreateLoopInvariantCodeMotion(), "LoopInvariantCodeMotion");
+#ifndef NDEBUG
+  // DCE trusts the use counts, so check them once the passes that edit uses are done
+  InsertPass(Validation::CreateUseListValidation(), "UseListValidation");
+#endif
+  InsertPass(CreatePassDeadCodeElimination(), "DeadCodeElimination");
 
   // If the IR is compacted post-RA then the node indexing gets messed up and the backend isn't able to find the register assigned to a node
   // Compact before IR, don't worry about RA generating spills/fills
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateIRCompaction()));
+  InsertPass(CreateIRCompaction(), "IRCompaction");
 }
 
 void PassManager::AddDefaultValidationPasses() {
 #ifndef NDEBUG
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(Validation::CreatePhiValidation()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(Validation::CreateIRValidation()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(Validation::CreateValueDominanceValidation()));
+  InsertPass(Validation::CreatePhiValidation(), "PhiValidation");
+  InsertPass(Validation::CreateIRValidation(), "IRValidation");
+  InsertPass(Validation::CreateValueDominanceValidation(), "ValueDominanceValidation");
 #endif
 }
 
-bool PassManager::Run(OpDispatchBuilder *Disp) {
+bool PassManager::Run(OpDispatchBuilder *Disp, FEXCore::Core::RuntimeStats *Stats) {
   bool Changed = false;
-  for (auto const &Pass : Passes) {
-    Changed |= Pass->Run(Disp);
+  if (!Stats) {
+    for (auto const &Pass : Passes) {
+      Changed |= Pass->Run(Disp);
+    }
+    return Changed;
+  }
+
+  if (Stats->Passes.size() != Passes.size()) {
+    Stats->Passes.resize(Passes.size());
+    for (size_t i = 0; i < Passes.size(); ++i) {
+      Stats->Passes[i].Name = PassNames[i];
+    }
+  }
+
+  uint64_t Nodes = GetLiveNodeCount(Disp);
+  for (size_t i = 0; i < Passes.size(); ++i) {
+    auto &PassStats = Stats->Passes[i];
+
+    auto Start = std::chrono::steady_clock::now();
+    Changed |= Passes[i]->Run(Disp);
+    auto End = std::chrono::steady_clock::now();
+
+    PassStats.NodesBefore += Nodes;
+    Nodes = GetLiveNodeCount(Disp);
+    PassStats.NodesAfter += Nodes;
+    PassStats.Time += std::chrono::duration_cast<std::chrono::nanoseconds>(End - Start).count();
+    ++PassStats.Runs;
   }
   return Changed;
 }
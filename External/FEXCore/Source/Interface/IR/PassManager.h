@@ -3,8 +3,13 @@
 #include <FEXCore/IR/IntrusiveIRList.h>
 
 #include <memory>
+#include <string>
 #include <vector>
 
+namespace FEXCore::Core {
+  struct RuntimeStats;
+}
+
 namespace FEXCore::IR {
 class OpDispatchBuilder;
 
@@ -18,13 +23,21 @@ class PassManager final {
 public:
   void AddDefaultPasses();
   void AddDefaultValidationPasses();
-  void InsertPass(Pass *Pass) {
+  void InsertPass(Pass *Pass, std::string const &Name) {
     Passes.emplace_back(Pass);
+    PassNames.emplace_back(Name);
   }
-  bool Run(OpDispatchBuilder *Disp);
+
+  /**
+   * @brief Runs every pass over the dispatcher's IR
+   *
+   * @param Stats If not null then time spent and IR node counts are accumulated per pass
+   */
+  bool Run(OpDispatchBuilder *Disp, FEXCore::Core::RuntimeStats *Stats = nullptr);
 
 private:
   std::vector<std::unique_ptr<Pass>> Passes;
+  std::vector<std::string> PassNames;
 };
 }
 
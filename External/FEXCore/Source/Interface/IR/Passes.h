@@ -6,9 +6,11 @@ class RegisterAllocationPass;
 
 FEXCore::IR::Pass* CreateConstProp();
 FEXCore::IR::Pass* CreateContextLoadStoreElimination();
+FEXCore::IR::Pass* CreateMemoryLoadStoreElimination();
 FEXCore::IR::Pass* CreateSyscallOptimization();
 FEXCore::IR::Pass* CreateRedundantFlagCalculationEliminination();
 FEXCore::IR::Pass* CreateDeadFlagCalculationEliminination();
+FEXCore::IR::Pass* CreateLoopInvariantCodeMotion();
 FEXCore::IR::Pass* CreatePassDeadCodeElimination();
 FEXCore::IR::Pass* CreateIRCompaction();
 FEXCore::IR::RegisterAllocationPass* CreateRegisterAllocationPass();
@@ -17,6 +19,7 @@ namespace Validation {
 FEXCore::IR::Pass* CreateIRValidation();
 FEXCore::IR::Pass* CreatePhiValidation();
 FEXCore::IR::Pass* CreateValueDominanceValidation();
+FEXCore::IR::Pass* CreateUseListValidation();
 }
 }
 
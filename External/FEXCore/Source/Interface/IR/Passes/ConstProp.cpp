@@ -91,7 +91,7 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
           uint64_t NewConstant = Constant1 + Constant2;
           Disp->SetWriteCursor(CodeNode);
           auto ConstantVal = Disp->_Constant(NewConstant);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, ConstantVal);
           Changed = true;
         }
       break;
@@ -106,7 +106,7 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
           uint64_t NewConstant = Constant1 - Constant2;
           Disp->SetWriteCursor(CodeNode);
           auto ConstantVal = Disp->_Constant(NewConstant);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, ConstantVal);
           Changed = true;
         }
       break;
@@ -121,7 +121,7 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
           uint64_t NewConstant = Constant1 & Constant2;
           Disp->SetWriteCursor(CodeNode);
           auto ConstantVal = Disp->_Constant(NewConstant);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, ConstantVal);
           Changed = true;
         }
       break;
@@ -136,7 +136,7 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
           uint64_t NewConstant = Constant1 | Constant2;
           Disp->SetWriteCursor(CodeNode);
           auto ConstantVal = Disp->_Constant(NewConstant);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, ConstantVal);
           Changed = true;
         }
       break;
@@ -151,7 +151,7 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
           uint64_t NewConstant = Constant1 ^ Constant2;
           Disp->SetWriteCursor(CodeNode);
           auto ConstantVal = Disp->_Constant(NewConstant);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, ConstantVal);
           Changed = true;
         }
       break;
@@ -166,7 +166,7 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
           uint64_t NewConstant = Constant1 << Constant2;
           Disp->SetWriteCursor(CodeNode);
           auto ConstantVal = Disp->_Constant(NewConstant);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, ConstantVal);
           Changed = true;
         }
       break;
@@ -185,7 +185,7 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
           uint64_t NewConstant = (Constant & SourceMask) >> Op->lsb;
           Disp->SetWriteCursor(CodeNode);
           auto ConstantVal = Disp->_Constant(NewConstant);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, ConstantVal);
           Changed = true;
         }
 
@@ -198,7 +198,7 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
           uint64_t NewConstant = Constant & ((1ULL << Op->SrcSize) - 1);
           Disp->SetWriteCursor(CodeNode);
           auto ConstantVal = Disp->_Constant(NewConstant);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, ConstantVal);
           Changed = true;
         }
       break;
@@ -213,7 +213,7 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
           uint64_t NewConstant = Constant1 * Constant2;
           Disp->SetWriteCursor(CodeNode);
           auto ConstantVal = Disp->_Constant(NewConstant);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, ConstantVal);
           Changed = true;
         }
       }
@@ -43,31 +43,12 @@ bool DeadCodeElimination::Run(OpDispatchBuilder *Disp) {
       auto IROp = CodeNode->Op(DataBegin);
 
       switch (IROp->Op) {
-      // State/memory storage
-      case OP_STORECONTEXTINDEXED:
-      case OP_STORECONTEXT:
-      case OP_STOREFLAG:
-      case OP_STOREMEM:
-      case OP_CAS:
-        // Keep
-        break;
-      // IO
-      case OP_SYSCALL:
-        // Keep
-        break;
-      // Control flow
-      case OP_BREAK:
-      case OP_JUMP:
-      case OP_EXITFUNCTION:
-      case OP_CONDJUMP:
-        // Keep
-        break;
       case OP_DUMMY:
       case OP_ENDBLOCK:
         // Keep, so we don't have to update block first/last
         break;
       default:
-        if (CodeNode->GetUses() == 0) {
+        if (CodeNode->GetUses() == 0 && !GetProperties(IROp->Op).HasSideEffects) {
           NumRemoved++;
           Disp->Remove(CodeNode);
         }
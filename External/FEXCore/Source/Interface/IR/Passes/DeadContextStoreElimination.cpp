@@ -385,11 +385,11 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::OpDispatchBuilder *Disp)
             Disp->SetWriteCursor(CodeNode);
             // XMM needs a bit of special help
             auto BitCast = Disp->_VBitcast(LastNode);
-            Disp->ReplaceAllUsesWithInclusive(CodeNode, BitCast, CodeBegin, CodeLast);
+            Disp->RewriteUses(CodeNode, BitCast);
             RecordAccess(Info, Op->Offset, Op->Size, ACCESS_READ, BitCast);
           }
           else {
-            Disp->ReplaceAllUsesWithInclusive(CodeNode, LastNode, CodeBegin, CodeLast);
+            Disp->RewriteUses(CodeNode, LastNode);
             RecordAccess(Info, Op->Offset, Op->Size, ACCESS_READ, LastNode);
           }
           if (CodeNode->GetUses() == 0)
@@ -399,7 +399,7 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::OpDispatchBuilder *Disp)
         else if (LastAccess == ACCESS_READ &&
                  Info->Accessed == ACCESS_READ) {
           // Did we read and then read again?
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, LastNode, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, LastNode);
           RecordAccess(Info, Op->Offset, Op->Size, ACCESS_READ, LastNode);
 
           if (CodeNode->GetUses() == 0)
@@ -433,7 +433,7 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::OpDispatchBuilder *Disp)
           // If the last store matches this load value then we can replace the loaded value with the previous valid one
           Disp->SetWriteCursor(CodeNode);
           auto Res = Disp->_Bfe(1, 0, LastNode);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, Res, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, Res);
           if (CodeNode->GetUses() == 0)
             Disp->Remove(CodeNode);
           RecordAccess(Info, offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1, ACCESS_READ, Res);
@@ -441,7 +441,7 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::OpDispatchBuilder *Disp)
         }
         else if (LastAccess == ACCESS_READ) {
           Disp->SetWriteCursor(CodeNode);
-          Disp->ReplaceAllUsesWithInclusive(CodeNode, LastNode, CodeBegin, CodeLast);
+          Disp->RewriteUses(CodeNode, LastNode);
           RecordAccess(Info, offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1, ACCESS_READ, CodeNode);
 
           if (CodeNode->GetUses() == 0)
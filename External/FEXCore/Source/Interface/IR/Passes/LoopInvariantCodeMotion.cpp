@@ -0,0 +1,280 @@
+#include "Interface/IR/PassManager.h"
+#include "Interface/IR/ControlFlowGraph.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include <FEXCore/Core/CoreState.h>
+#include "LogManager.h"
+
+#include <algorithm>
+
+namespace FEXCore::IR {
+
+/**
+ * @brief Hoists loop invariant values in to the loop's preheader
+ *
+ * Pure ops whose arguments are all defined outside of the loop are moved out of the loop.
+ * Context loads are moved as well if nothing inside of the loop can write to the loaded context location.
+ * Constants only get hoisted when an op that uses them is hoisted, otherwise they are cheaper to keep local.
+ */
+class LoopInvariantCodeMotion final : public FEXCore::IR::Pass {
+public:
+  bool Run(OpDispatchBuilder *Disp) override;
+
+private:
+  struct ContextRange {
+    uint32_t Offset;
+    uint32_t Size;
+  };
+
+  ControlFlowGraph CFG;
+  // Block index for every node in the IR
+  std::vector<uint32_t> NodeBlock;
+  std::vector<ContextRange> ContextWrites;
+
+  bool HoistLoop(OpDispatchBuilder *Disp, IRListView<false> *IR, uint32_t LoopIndex);
+};
+
+static bool IsPureOp(FEXCore::IR::IROp_Header const *IROp) {
+  // Constants are hoisted along with their users, phis are tied to their block
+  if (IROp->Op == OP_CONSTANT || IROp->Op == OP_PHI || !IROp->HasDest) {
+    return false;
+  }
+
+  // Ops that can fault must not be executed speculatively
+  auto const &Properties = GetProperties(IROp->Op);
+  return !Properties.HasSideEffects &&
+    !Properties.MemoryRead &&
+    !Properties.ContextRead &&
+    !Properties.CanFault;
+}
+
+bool LoopInvariantCodeMotion::Run(OpDispatchBuilder *Disp) {
+  auto CurrentIR = Disp->ViewIR();
+  CFG.Calculate(&CurrentIR);
+
+  auto const &Loops = CFG.GetLoops();
+  if (Loops.empty()) {
+    return false;
+  }
+
+  uintptr_t DataBegin = CurrentIR.GetData();
+
+  NodeBlock.assign(CurrentIR.GetSSACount(), ControlFlowGraph::InvalidBlock);
+  for (uint32_t Block = 0; Block < CFG.GetBlockCount(); ++Block) {
+    auto BlockIROp = CFG.GetBlock(Block).Node->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+
+    // We grab these nodes this way so we can iterate easily
+    auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+    auto CodeLast = CurrentIR.at(BlockIROp->Last);
+    while (1) {
+      NodeBlock[CodeBegin()->ID()] = Block;
+
+      // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+  }
+
+  bool Changed = false;
+  // Inner loops are first, anything hoisted out of them can then get hoisted out of the enclosing loop
+  for (uint32_t i = 0; i < Loops.size(); ++i) {
+    Changed |= HoistLoop(Disp, &CurrentIR, i);
+  }
+
+  return Changed;
+}
+
+bool LoopInvariantCodeMotion::HoistLoop(OpDispatchBuilder *Disp, IRListView<false> *IR, uint32_t LoopIndex) {
+  auto const &Loop = CFG.GetLoops()[LoopIndex];
+  if (Loop.Preheader == ControlFlowGraph::InvalidBlock) {
+    return false;
+  }
+
+  // RA and the backends walk the blocks in list order and expect definitions to be seen before their uses
+  // Only hoist if the preheader comes before every block of the loop
+  if (Loop.Preheader > Loop.Blocks.front()) {
+    return false;
+  }
+
+  uintptr_t ListBegin = IR->GetListData();
+  uintptr_t DataBegin = IR->GetData();
+
+  OrderedNode *InsertPoint{};
+  {
+    auto BlockIROp = CFG.GetBlock(Loop.Preheader).Node->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    auto CodeBegin = IR->at(BlockIROp->Begin);
+    auto CodeLast = IR->at(BlockIROp->Last);
+    while (1) {
+      OrderedNode *CodeNode = CodeBegin()->GetNode(ListBegin);
+      auto IROp = CodeNode->Op(DataBegin);
+      if (IROp->Op == OP_JUMP) {
+        InsertPoint = CodeNode;
+      }
+      else if (IROp->Op == OP_CONDJUMP) {
+        return false;
+      }
+
+      // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+  }
+
+  if (!InsertPoint) {
+    return false;
+  }
+
+  // Gather everything the loop can write to the context
+  bool ContextBarrier = false;
+  ContextWrites.clear();
+  for (auto Block : Loop.Blocks) {
+    auto BlockIROp = CFG.GetBlock(Block).Node->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    auto CodeBegin = IR->at(BlockIROp->Begin);
+    auto CodeLast = IR->at(BlockIROp->Last);
+    while (1) {
+      auto IROp = CodeBegin()->GetNode(ListBegin)->Op(DataBegin);
+      switch (IROp->Op) {
+        case OP_STORECONTEXT: {
+          auto Op = IROp->C<IR::IROp_StoreContext>();
+          ContextWrites.emplace_back(ContextRange{Op->Offset, Op->Size});
+          break;
+        }
+        case OP_STOREFLAG: {
+          auto Op = IROp->C<IR::IROp_StoreFlag>();
+          ContextWrites.emplace_back(ContextRange{static_cast<uint32_t>(offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag), 1});
+          break;
+        }
+        default:
+          // Anything else that can write to the context does so behind the IR's back
+          if (GetProperties(IROp->Op).ContextWrite) {
+            ContextBarrier = true;
+          }
+          break;
+      }
+
+      // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+  }
+
+  auto IsContextInvariant = [&](uint32_t Offset, uint32_t Size) {
+    if (ContextBarrier) {
+      return false;
+    }
+
+    for (auto const &Write : ContextWrites) {
+      if (Offset < (Write.Offset + Write.Size) &&
+          Write.Offset < (Offset + Size)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  auto IsDefinedOutside = [&](OrderedNodeWrapper Arg) {
+    uint32_t Block = NodeBlock[Arg.ID()];
+    return Block != ControlFlowGraph::InvalidBlock &&
+      !CFG.IsBlockInLoop(LoopIndex, Block) &&
+      CFG.Dominates(Block, Loop.Preheader);
+  };
+
+  auto IsLoopConstant = [&](OrderedNodeWrapper Arg) {
+    return CFG.IsBlockInLoop(LoopIndex, NodeBlock[Arg.ID()]) &&
+      Arg.GetNode(ListBegin)->Op(DataBegin)->Op == OP_CONSTANT;
+  };
+
+  auto Hoist = [&](OrderedNode *Node) {
+    Disp->MoveBefore(Node, InsertPoint);
+    NodeBlock[Node->Wrapped(ListBegin).ID()] = Loop.Preheader;
+  };
+
+  // Walk the loop in reverse post order so definitions are generally seen before their uses
+  std::vector<uint32_t> LoopBlocks = Loop.Blocks;
+  std::sort(LoopBlocks.begin(), LoopBlocks.end(), [&](uint32_t LHS, uint32_t RHS) {
+    return CFG.GetBlock(LHS).RPONumber < CFG.GetBlock(RHS).RPONumber;
+  });
+
+  bool Changed = false;
+  bool Progress = true;
+  while (Progress) {
+    Progress = false;
+
+    for (auto Block : LoopBlocks) {
+      auto BlockIROp = CFG.GetBlock(Block).Node->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+      auto CodeBegin = IR->at(BlockIROp->Begin);
+      auto CodeLast = IR->at(BlockIROp->Last);
+
+      while (1) {
+        OrderedNode *CodeNode = CodeBegin()->GetNode(ListBegin);
+        auto IROp = CodeNode->Op(DataBegin);
+
+        // Step before potentially moving the node out from under the iterator
+        bool LastNode = CodeBegin == CodeLast;
+        if (!LastNode) {
+          ++CodeBegin;
+        }
+
+        bool Invariant = false;
+        switch (IROp->Op) {
+          case OP_LOADCONTEXT: {
+            auto Op = IROp->C<IR::IROp_LoadContext>();
+            Invariant = IsContextInvariant(Op->Offset, Op->Size);
+            break;
+          }
+          case OP_LOADFLAG: {
+            auto Op = IROp->C<IR::IROp_LoadFlag>();
+            Invariant = IsContextInvariant(offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1);
+            break;
+          }
+          default: {
+            if (IsPureOp(IROp)) {
+              Invariant = true;
+              uint8_t NumArgs = IR::GetArgs(IROp->Op);
+              for (uint8_t i = 0; i < NumArgs; ++i) {
+                if (!IsDefinedOutside(IROp->Args[i]) &&
+                    !IsLoopConstant(IROp->Args[i])) {
+                  Invariant = false;
+                  break;
+                }
+              }
+            }
+            break;
+          }
+        }
+
+        if (Invariant) {
+          // Constants come along with the first op that needs them
+          uint8_t NumArgs = IR::GetArgs(IROp->Op);
+          for (uint8_t i = 0; i < NumArgs; ++i) {
+            if (IsLoopConstant(IROp->Args[i])) {
+              Hoist(IROp->Args[i].GetNode(ListBegin));
+            }
+          }
+
+          Hoist(CodeNode);
+          Changed = true;
+          Progress = true;
+        }
+
+        if (LastNode) {
+          break;
+        }
+      }
+    }
+  }
+
+  return Changed;
+}
+
+FEXCore::IR::Pass* CreateLoopInvariantCodeMotion() {
+  return new LoopInvariantCodeMotion{};
+}
+
+}
@@ -0,0 +1,339 @@
+#include "Interface/IR/PassManager.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include <FEXCore/Core/CoreState.h>
+#include "LogManager.h"
+
+#include <unordered_map>
+
+namespace FEXCore::IR {
+
+/**
+ * @brief Block local store to load forwarding and dead store elimination for guest memory
+ *
+ * Addresses are decomposed in to a base node plus a constant offset.
+ * GPR context loads are looked through so that each instruction reloading RSP still ends up at the same base.
+ *
+ * eg.
+ *   %ssa4 i64 = LoadContext 0x8, 0x28
+ *   %ssa5 i64 = Sub %ssa4 i64, %ssa3 i64
+ *   (%%ssa6) StoreContext %ssa5 i64, 0x8, 0x28
+ *   (%%ssa7) StoreMem %ssa5 i64, %ssa2 i64, 0x8, 0x8
+ *   %ssa8 i64 = LoadContext 0x8, 0x28
+ *   %ssa9 i64 = LoadMem %ssa8 i64, 0x8, 0x8
+ * Converts to
+ *   %ssa4 i64 = LoadContext 0x8, 0x28
+ *   %ssa5 i64 = Sub %ssa4 i64, %ssa3 i64
+ *   (%%ssa6) StoreContext %ssa5 i64, 0x8, 0x28
+ *   (%%ssa7) StoreMem %ssa5 i64, %ssa2 i64, 0x8, 0x8
+ *   %ssa8 i64 = LoadContext 0x8, 0x28
+ *   %ssa9 i64 = LoadMem %ssa8 i64, 0x8, 0x8 <- Uses replaced with %ssa2
+ *
+ * GPR loads that only read part of a known value get a Bfe of the bytes they cover.
+ *
+ * Accesses with the same base only alias if their ranges overlap.
+ * Accesses with different bases may always alias.
+ * Atomics, syscalls and anything that can leave the block are full barriers.
+ */
+class MemoryLoadStoreElimination final : public FEXCore::IR::Pass {
+public:
+  bool Run(OpDispatchBuilder *Disp) override;
+
+private:
+  struct MemoryAddress {
+    OrderedNode *Base;
+    int64_t Offset;
+  };
+
+  struct MemoryAccess {
+    MemoryAddress Address;
+    uint8_t Size;
+    RegisterClassType Class;
+    // Value currently held in memory at this address
+    OrderedNode *Value;
+  };
+
+  struct PendingStore {
+    MemoryAddress Address;
+    uint8_t Size;
+    OrderedNode *Node;
+  };
+
+  // Values known to be in memory
+  std::vector<MemoryAccess> KnownValues;
+  // Stores that haven't been observed by a load yet
+  std::vector<PendingStore> PendingStores;
+  // Last known value of 64bit GPR context members. Only used for address calculation
+  std::unordered_map<uint32_t, OrderedNode*> ContextValues;
+  // Context loads that are known to return an earlier value
+  std::unordered_map<OrderedNode*, OrderedNode*> ContextLoadValues;
+
+  MemoryAddress DecomposeAddress(OrderedNodeWrapper Address, uintptr_t ListBegin, uintptr_t DataBegin);
+  void ResetBlockState();
+};
+
+void MemoryLoadStoreElimination::ResetBlockState() {
+  KnownValues.clear();
+  PendingStores.clear();
+  ContextValues.clear();
+  ContextLoadValues.clear();
+}
+
+MemoryLoadStoreElimination::MemoryAddress MemoryLoadStoreElimination::DecomposeAddress(OrderedNodeWrapper Address, uintptr_t ListBegin, uintptr_t DataBegin) {
+  OrderedNode *Node = Address.GetNode(ListBegin);
+  int64_t Offset = 0;
+
+  auto GetConstant = [&](OrderedNodeWrapper Arg, uint64_t *Constant) {
+    auto IROp = Arg.GetNode(ListBegin)->Op(DataBegin);
+    if (IROp->Op == OP_CONSTANT) {
+      *Constant = IROp->C<IR::IROp_Constant>()->Constant;
+      return true;
+    }
+    return false;
+  };
+
+  while (1) {
+    auto IROp = Node->Op(DataBegin);
+    uint64_t Constant;
+
+    // Only full width math can be folded in to the offset, smaller sizes would wrap
+    if (IROp->Op == OP_ADD && IROp->Size == 8) {
+      if (GetConstant(IROp->Args[1], &Constant)) {
+        Offset += Constant;
+        Node = IROp->Args[0].GetNode(ListBegin);
+        continue;
+      }
+      if (GetConstant(IROp->Args[0], &Constant)) {
+        Offset += Constant;
+        Node = IROp->Args[1].GetNode(ListBegin);
+        continue;
+      }
+    }
+    else if (IROp->Op == OP_SUB && IROp->Size == 8) {
+      if (GetConstant(IROp->Args[1], &Constant)) {
+        Offset -= Constant;
+        Node = IROp->Args[0].GetNode(ListBegin);
+        continue;
+      }
+    }
+    else if (IROp->Op == OP_LOADCONTEXT) {
+      auto it = ContextLoadValues.find(Node);
+      if (it != ContextLoadValues.end()) {
+        Node = it->second;
+        continue;
+      }
+    }
+    break;
+  }
+
+  return MemoryAddress{Node, Offset};
+}
+
+bool MemoryLoadStoreElimination::Run(OpDispatchBuilder *Disp) {
+  bool Changed = false;
+  auto CurrentIR = Disp->ViewIR();
+  uintptr_t ListBegin = CurrentIR.GetListData();
+  uintptr_t DataBegin = CurrentIR.GetData();
+  auto OriginalWriteCursor = Disp->GetWriteCursor();
+
+  auto Begin = CurrentIR.begin();
+  auto Op = Begin();
+
+  OrderedNode *RealNode = Op->GetNode(ListBegin);
+  auto HeaderOp = RealNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+  LogMan::Throw::A(HeaderOp->Header.Op == OP_IRHEADER, "First op wasn't IRHeader");
+
+  auto Overlaps = [](MemoryAddress const &LHS, uint8_t LHSSize, MemoryAddress const &RHS, uint8_t RHSSize) {
+    return LHS.Offset < (RHS.Offset + RHSSize) &&
+      RHS.Offset < (LHS.Offset + LHSSize);
+  };
+
+  // Different bases could be anything so they must be treated as aliasing
+  auto MayAlias = [&](MemoryAddress const &LHS, uint8_t LHSSize, MemoryAddress const &RHS, uint8_t RHSSize) {
+    return LHS.Base != RHS.Base || Overlaps(LHS, LHSSize, RHS, RHSSize);
+  };
+
+  auto MustAlias = [](MemoryAddress const &LHS, uint8_t LHSSize, MemoryAddress const &RHS, uint8_t RHSSize) {
+    return LHS.Base == RHS.Base && LHS.Offset == RHS.Offset && LHSSize == RHSSize;
+  };
+
+  // RHS lies entirely within LHS
+  auto Contains = [](MemoryAddress const &LHS, uint8_t LHSSize, MemoryAddress const &RHS, uint8_t RHSSize) {
+    return LHS.Base == RHS.Base && LHS.Offset <= RHS.Offset &&
+      (RHS.Offset + RHSSize) <= (LHS.Offset + LHSSize);
+  };
+
+  OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+  while (1) {
+    auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    LogMan::Throw::A(BlockIROp->Header.Op == OP_CODEBLOCK, "IR type failed to be a code block");
+
+    ResetBlockState();
+
+    // We grab these nodes this way so we can iterate easily
+    auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+    auto CodeLast = CurrentIR.at(BlockIROp->Last);
+
+    while (1) {
+      auto CodeOp = CodeBegin();
+      OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+      auto IROp = CodeNode->Op(DataBegin);
+
+      switch (IROp->Op) {
+        case OP_STOREMEM: {
+          auto Op = IROp->CW<IR::IROp_StoreMem>();
+          auto Address = DecomposeAddress(Op->Header.Args[0], ListBegin, DataBegin);
+
+          // Any earlier store that this store fully overwrites without being observed is dead
+          for (auto it = PendingStores.begin(); it != PendingStores.end();) {
+            if (MustAlias(it->Address, it->Size, Address, Op->Size)) {
+              Disp->Remove(it->Node);
+              it = PendingStores.erase(it);
+              Changed = true;
+            }
+            else {
+              ++it;
+            }
+          }
+
+          for (auto it = KnownValues.begin(); it != KnownValues.end();) {
+            if (MayAlias(it->Address, it->Size, Address, Op->Size)) {
+              it = KnownValues.erase(it);
+            }
+            else {
+              ++it;
+            }
+          }
+
+          KnownValues.emplace_back(MemoryAccess{Address, Op->Size, Op->Class, Op->Header.Args[1].GetNode(ListBegin)});
+          PendingStores.emplace_back(PendingStore{Address, Op->Size, CodeNode});
+          break;
+        }
+        case OP_LOADMEM: {
+          auto Op = IROp->CW<IR::IROp_LoadMem>();
+          auto Address = DecomposeAddress(Op->Header.Args[0], ListBegin, DataBegin);
+
+          // This load observes every store it may alias
+          for (auto it = PendingStores.begin(); it != PendingStores.end();) {
+            if (MayAlias(it->Address, it->Size, Address, Op->Size)) {
+              it = PendingStores.erase(it);
+            }
+            else {
+              ++it;
+            }
+          }
+
+          MemoryAccess *Known{};
+          for (auto &Access : KnownValues) {
+            if (Access.Class.Val != Op->Class.Val) {
+              continue;
+            }
+
+            if (MustAlias(Access.Address, Access.Size, Address, Op->Size) ||
+                (Op->Class.Val == FEXCore::IR::GPRClass.Val && Contains(Access.Address, Access.Size, Address, Op->Size))) {
+              Known = &Access;
+              break;
+            }
+          }
+
+          OrderedNode *Value = Known ? Known->Value : nullptr;
+          if (Value && Op->Class.Val == FEXCore::IR::FPRClass.Val) {
+            // Vector values need to match in size, partial stores of a vector register don't forward
+            if (Value->Op(DataBegin)->Size != Op->Size) {
+              Value = nullptr;
+            }
+          }
+
+          if (Value) {
+            uint8_t ByteOffset = Address.Offset - Known->Address.Offset;
+            if (Op->Class.Val == FEXCore::IR::GPRClass.Val && (Op->Size < 8 || ByteOffset != 0)) {
+              // Narrow stores only wrote the bottom bits of the value, narrow loads of a wider value pick their bytes out of it
+              Disp->SetWriteCursor(CodeNode);
+              Value = Disp->_Bfe(Op->Size * 8, ByteOffset * 8, Value);
+            }
+
+            Disp->RewriteUses(CodeNode, Value);
+            if (CodeNode->GetUses() == 0) {
+              Disp->Remove(CodeNode);
+            }
+            Changed = true;
+          }
+          else {
+            // Later loads from the same location can reuse this one
+            KnownValues.emplace_back(MemoryAccess{Address, Op->Size, Op->Class, CodeNode});
+          }
+          break;
+        }
+        case OP_STORECONTEXT: {
+          auto Op = IROp->CW<IR::IROp_StoreContext>();
+          // Drop anything this store partially overlaps
+          for (auto it = ContextValues.begin(); it != ContextValues.end();) {
+            if (Op->Offset < (it->first + 8) && it->first < (Op->Offset + Op->Size)) {
+              it = ContextValues.erase(it);
+            }
+            else {
+              ++it;
+            }
+          }
+
+          if (Op->Size == 8 && Op->Class.Val == FEXCore::IR::GPRClass.Val) {
+            ContextValues[Op->Offset] = Op->Header.Args[0].GetNode(ListBegin);
+          }
+          break;
+        }
+        case OP_LOADCONTEXT: {
+          auto Op = IROp->CW<IR::IROp_LoadContext>();
+          if (Op->Size == 8 && Op->Class.Val == FEXCore::IR::GPRClass.Val) {
+            auto it = ContextValues.try_emplace(Op->Offset, CodeNode);
+            if (!it.second) {
+              // Already know what this member holds, this load returns the same value
+              ContextLoadValues[CodeNode] = it.first->second;
+            }
+          }
+          break;
+        }
+        case OP_STORECONTEXTINDEXED:
+          ContextValues.clear();
+          break;
+        case OP_STOREFLAG:
+          // Flags never overlap the context members being tracked
+          break;
+        default: {
+          auto const &Properties = GetProperties(IROp->Op);
+          if (Properties.MemoryWrite || Properties.ContextWrite) {
+            // Full barrier, nothing can be assumed about memory or the context after this
+            ResetBlockState();
+          }
+          else if (Properties.MemoryRead) {
+            // Observes every store that hasn't been overwritten yet
+            PendingStores.clear();
+          }
+          break;
+        }
+      }
+
+      // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+
+    if (BlockIROp->Next.ID() == 0) {
+      break;
+    } else {
+      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+    }
+  }
+
+  Disp->SetWriteCursor(OriginalWriteCursor);
+
+  return Changed;
+}
+
+FEXCore::IR::Pass* CreateMemoryLoadStoreElimination() {
+  return new MemoryLoadStoreElimination{};
+}
+
+}
@@ -1,8 +1,10 @@
 #include "Common/BitSet.h"
+#include "Interface/IR/ControlFlowGraph.h"
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 #include "Interface/IR/Passes.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace {
@@ -306,18 +308,24 @@ namespace FEXCore::IR {
 
       void AllocateRegisterSet(uint32_t RegisterCount, uint32_t ClassCount) override;
       void AddRegisters(uint32_t Class, uint32_t RegisterCount) override;
+      void SetInlineConstantCheck(InlineConstantCheck Check) override { CanInlineConstant = Check; }
 
       /**
        * @brief Returns the register and class encoded together
        * Top 32bits is the class, lower 32bits is the register
        */
       uint64_t GetNodeRegister(uint32_t Node) override;
+      uint64_t GetLiveRegisterMask(uint32_t Class, uint32_t Node) override;
+      bool IsInlineConstant(uint32_t Node) override;
     private:
+      InlineConstantCheck CanInlineConstant {};
+      std::vector<bool> InlineConstants;
       std::vector<uint32_t> PhysicalRegisterCount;
       std::vector<uint32_t> TopRAPressure;
 
       RegisterGraph *Graph;
       std::unique_ptr<FEXCore::IR::Pass> LocalCompaction;
+      FEXCore::IR::ControlFlowGraph CFG;
 
       void SpillRegisters(FEXCore::IR::OpDispatchBuilder *Disp);
 
@@ -329,13 +337,14 @@ namespace FEXCore::IR {
       BlockInterferences GlobalBlockInterferences;
 
       void CalculateLiveRange(FEXCore::IR::IRListView<false> *IR);
+      void FindInlineConstants(FEXCore::IR::IRListView<false> *IR);
       void CalculateBlockInterferences(FEXCore::IR::IRListView<false> *IR);
       void CalculateBlockNodeInterference(FEXCore::IR::IRListView<false> *IR);
       void CalculateNodeInterference(FEXCore::IR::IRListView<false> *IR);
       void AllocateVirtualRegisters();
 
       FEXCore::IR::NodeWrapperIterator FindFirstUse(FEXCore::IR::OpDispatchBuilder *Disp, FEXCore::IR::OrderedNode* Node, FEXCore::IR::NodeWrapperIterator Begin, FEXCore::IR::NodeWrapperIterator End);
-      uint32_t FindNodeToSpill(RegisterNode *RegisterNode, uint32_t CurrentLocation, LiveRange const *OpLiveRange);
+      uint32_t FindNodeToSpill(RegisterNode *RegisterNode, uint32_t CurrentLocation, uint32_t BlockLast, LiveRange const *OpLiveRange);
       uint32_t FindSpillSlot(uint32_t Node, uint32_t RegisterClass);
 
       bool RunAllocateVirtualRegisters(OpDispatchBuilder *Disp);
@@ -369,6 +378,24 @@ namespace FEXCore::IR {
     return Reg;
   }
 
+  uint64_t ConstrainedRAPass::GetLiveRegisterMask(uint32_t Class, uint32_t Node) {
+    uint64_t Mask = 0;
+    size_t NodeCount = std::min<size_t>(Graph->NodeCount, LiveRanges.size());
+    for (uint32_t i = 0; i < NodeCount; ++i) {
+      // Values that die at this node or are defined by it don't need to survive it
+      if (LiveRanges[i].Begin < Node && LiveRanges[i].End > Node &&
+          Graph->Nodes[i].Head.RegisterClass == Class &&
+          Graph->Nodes[i].Head.Register < 64) {
+        Mask |= 1ULL << Graph->Nodes[i].Head.Register;
+      }
+    }
+    return Mask;
+  }
+
+  bool ConstrainedRAPass::IsInlineConstant(uint32_t Node) {
+    return Node < InlineConstants.size() && InlineConstants[Node];
+  }
+
   void ConstrainedRAPass::CalculateLiveRange(FEXCore::IR::IRListView<false> *IR) {
     using namespace FEXCore;
     size_t Nodes = IR->GetSSACount();
@@ -467,6 +494,117 @@ namespace FEXCore::IR {
         BlockNode = BlockIROp->Next.GetNode(ListBegin);
       }
     }
+
+    // A value defined before a loop and used inside of it is live across the loop's back-edge
+    // Extend its live range over the whole loop so nothing inside the loop can reuse its register
+    CFG.Calculate(IR);
+    for (auto const &Loop : CFG.GetLoops()) {
+      uint32_t LoopBegin = ~0U;
+      uint32_t LoopEnd = 0;
+      for (auto Block : Loop.Blocks) {
+        auto BlockIROp = CFG.GetBlock(Block).Node->Op(DataBegin)->C<FEXCore::IR::IROp_CodeBlock>();
+        LoopBegin = std::min(LoopBegin, BlockIROp->Begin.ID());
+        LoopEnd = std::max(LoopEnd, BlockIROp->Last.ID());
+      }
+
+      for (auto Block : Loop.Blocks) {
+        auto BlockIROp = CFG.GetBlock(Block).Node->Op(DataBegin)->C<FEXCore::IR::IROp_CodeBlock>();
+
+        // We grab these nodes this way so we can iterate easily
+        auto CodeBegin = IR->at(BlockIROp->Begin);
+        auto CodeLast = IR->at(BlockIROp->Last);
+        while (1) {
+          auto IROp = CodeBegin()->GetNode(ListBegin)->Op(DataBegin);
+
+          uint8_t NumArgs = IR::GetArgs(IROp->Op);
+          for (uint8_t i = 0; i < NumArgs; ++i) {
+            uint32_t ArgNode = IROp->Args[i].ID();
+            if (ArgNode < LoopBegin) {
+              LiveRanges[ArgNode].End = std::max(LiveRanges[ArgNode].End, LoopEnd);
+            }
+          }
+
+          // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+          if (CodeBegin == CodeLast) {
+            break;
+          }
+          ++CodeBegin;
+        }
+      }
+    }
+  }
+
+  void ConstrainedRAPass::FindInlineConstants(FEXCore::IR::IRListView<false> *IR) {
+    using namespace FEXCore;
+    InlineConstants.assign(IR->GetSSACount(), false);
+    if (!CanInlineConstant) {
+      return;
+    }
+
+    uintptr_t ListBegin = IR->GetListData();
+    uintptr_t DataBegin = IR->GetData();
+
+    // Start with every constant and drop the ones that have a use which needs a register
+    std::vector<bool> NeedsRegister(IR->GetSSACount(), false);
+
+    auto Begin = IR->begin();
+    auto Op = Begin();
+
+    IR::OrderedNode *RealNode = Op->GetNode(ListBegin);
+    auto HeaderOp = RealNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+    LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
+
+    IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+    while (1) {
+      auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+      LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
+
+      // We grab these nodes this way so we can iterate easily
+      auto CodeBegin = IR->at(BlockIROp->Begin);
+      auto CodeLast = IR->at(BlockIROp->Last);
+      while (1) {
+        auto CodeOp = CodeBegin();
+        auto IROp = CodeOp->GetNode(ListBegin)->Op(DataBegin);
+
+        if (IROp->Op == IR::OP_CONSTANT) {
+          InlineConstants[CodeOp->ID()] = true;
+        }
+
+        uint8_t NumArgs = IR::GetArgs(IROp->Op);
+        for (uint8_t i = 0; i < NumArgs; ++i) {
+          auto ArgOp = IROp->Args[i].GetNode(ListBegin)->Op(DataBegin);
+          if (ArgOp->Op == IR::OP_CONSTANT &&
+              !CanInlineConstant(IROp, i, ArgOp->C<IR::IROp_Constant>()->Constant)) {
+            NeedsRegister[IROp->Args[i].ID()] = true;
+          }
+        }
+
+        // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+        if (CodeBegin == CodeLast) {
+          break;
+        }
+        ++CodeBegin;
+      }
+
+      if (BlockIROp->Next.ID() == 0) {
+        break;
+      } else {
+        BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      }
+    }
+
+    for (uint32_t i = 0; i < InlineConstants.size(); ++i) {
+      if (InlineConstants[i] && !NeedsRegister[i]) {
+        // No class means no register, an empty live range means nothing interferes with it
+        Graph->Nodes[i].Head.RegisterClass = INVALID_CLASS;
+        LiveRanges[i].Begin = ~0U;
+        LiveRanges[i].End = ~0U;
+      }
+      else {
+        InlineConstants[i] = false;
+      }
+    }
   }
 
   void ConstrainedRAPass::CalculateBlockInterferences(FEXCore::IR::IRListView<false> *IR) {
@@ -728,7 +866,7 @@ namespace FEXCore::IR {
     return FEXCore::IR::NodeWrapperIterator::Invalid();
   }
 
-  uint32_t ConstrainedRAPass::FindNodeToSpill(RegisterNode *RegisterNode, uint32_t CurrentLocation, LiveRange const *OpLiveRange) {
+  uint32_t ConstrainedRAPass::FindNodeToSpill(RegisterNode *RegisterNode, uint32_t CurrentLocation, uint32_t BlockLast, LiveRange const *OpLiveRange) {
     uint32_t InterferenceToSpill = ~0U;
     uint32_t InterferenceLowestCost = ~0U;
     uint32_t InterferenceFarthest = 0;
@@ -740,6 +878,12 @@ namespace FEXCore::IR {
         continue;
       }
 
+      // Fills only get inserted in to the current block
+      // Values live past the end of this block can't be spilled here
+      if (InterferenceLiveRange->End > BlockLast) {
+        continue;
+      }
+
       // If the interference's live range is past this op's live range then we can dump it
       if (InterferenceLiveRange->End > OpLiveRange->End &&
           InterferenceLiveRange->RematCost != 1) {
@@ -767,7 +911,8 @@ namespace FEXCore::IR {
         uint32_t InterferenceNode = RegisterNode->InterferenceList[j];
         auto *InterferenceLiveRange = &LiveRanges[InterferenceNode];
 
-        if (CurrentLocation < InterferenceLiveRange->Begin) {
+        if (CurrentLocation < InterferenceLiveRange->Begin ||
+            InterferenceLiveRange->End > BlockLast) {
           continue;
         }
 
@@ -873,6 +1018,7 @@ namespace FEXCore::IR {
             for (uint32_t j = 0; j < CurrentNode->Head.InterferenceCount; ++j) {
               uint32_t InterferenceNode = CurrentNode->InterferenceList[j];
               if (LiveRanges[InterferenceNode].End > OpLiveRange->End &&
+                  LiveRanges[InterferenceNode].End <= BlockIROp->Last.ID() &&
                   LiveRanges[InterferenceNode].RematCost == 1) { // CONSTANT
                 // We want to end the live range of this value here and continue it on first use
                 IR::OrderedNodeWrapper ConstantOp = IR::OrderedNodeWrapper::WrapOffset(InterferenceNode * sizeof(IR::OrderedNode));
@@ -898,7 +1044,7 @@ namespace FEXCore::IR {
 
             // If we didn't remat a constant then we need to do some real spilling
             if (!Spilled) {
-              uint32_t InterferenceNode = FindNodeToSpill(CurrentNode, Node, OpLiveRange);
+              uint32_t InterferenceNode = FindNodeToSpill(CurrentNode, Node, BlockIROp->Last.ID(), OpLiveRange);
               if (InterferenceNode != ~0U) {
                 uint32_t SpillSlot = FindSpillSlot(InterferenceNode, Graph->Nodes[InterferenceNode].Head.RegisterClass);
                 RegisterNode *InterferenceRegisterNode = &Graph->Nodes[InterferenceNode];
@@ -986,6 +1132,7 @@ namespace FEXCore::IR {
     ResetRegisterGraph(Graph, SSACount);
     FindNodeClasses(Graph, &IR);
     CalculateLiveRange(&IR);
+    FindInlineConstants(&IR);
 
     // Linear foward scan based interference calculation is faster for smaller blocks
     // Smarter block based interference calculation is faster for larger blocks
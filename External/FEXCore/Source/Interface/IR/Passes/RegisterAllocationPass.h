@@ -4,6 +4,7 @@
 namespace FEXCore::IR {
 template<bool>
 class IRListView;
+struct IROp_Header;
 
 class RegisterAllocationPass : public FEXCore::IR::Pass {
   public:
@@ -16,6 +17,21 @@ class RegisterAllocationPass : public FEXCore::IR::Pass {
     virtual void AllocateRegisterSet(uint32_t RegisterCount, uint32_t ClassCount) = 0;
     virtual void AddRegisters(uint32_t Class, uint32_t RegisterCount) = 0;
 
+    /**
+     * @brief Checks if an op can encode a constant argument directly in to its instruction
+     *
+     * @param IROp - The op using the constant
+     * @param Arg - Which argument of the op the constant is
+     * @param Constant - The value of the constant
+     */
+    using InlineConstantCheck = bool(*)(IROp_Header const *IROp, uint8_t Arg, uint64_t Constant);
+
+    /**
+     * @brief Constants that are only used in positions the backend can encode directly don't get a register
+     * The backend is expected to encode every use of them itself
+     */
+    virtual void SetInlineConstantCheck(InlineConstantCheck Check) = 0;
+
     /**
      * @name Inference graph handling
      * @{ */
@@ -25,6 +41,17 @@ class RegisterAllocationPass : public FEXCore::IR::Pass {
      * Top 32bits is the class, lower 32bits is the register
      */
     virtual uint64_t GetNodeRegister(uint32_t Node) = 0;
+
+    /**
+     * @brief Returns a mask of the registers in a class that hold a value which is live across a node
+     * Backends use this to only preserve the registers that matter around calls
+     */
+    virtual uint64_t GetLiveRegisterMask(uint32_t Class, uint32_t Node) = 0;
+
+    /**
+     * @brief Returns true if the node is a constant that was left without a register
+     */
+    virtual bool IsInlineConstant(uint32_t Node) = 0;
     /**  @} */
 
   protected:
@@ -1,5 +1,6 @@
 #include "Interface/IR/PassManager.h"
 #include "Interface/Core/OpcodeDispatcher.h"
+#include "Interface/HLE/Syscalls.h"
 
 #include "LogManager.h"
 
@@ -40,11 +41,23 @@ bool SyscallOptimization::Run(OpDispatchBuilder *Disp) {
       if (IROp->Op == FEXCore::IR::OP_SYSCALL) {
         // Is the first argument a constant?
         uint64_t Constant;
-        if (Disp->IsValueConstant(IROp->Args[0], &Constant)) {
-          // XXX: We can now optimize this syscall
-          //Changed = true;
+        if (Disp->IsValueConstant(IROp->Args[0], &Constant) &&
+            FEXCore::SyscallHandler::GetDirectHandler(Constant)) {
+          // Bind the syscall directly to its handler so the backends can skip the syscall dispatch
+          auto NewOp = Disp->AllocateOrphanOp<IROp_SyscallDirect, OP_SYSCALLDIRECT>();
+          NewOp->Header.Size = IROp->Size;
+          NewOp->Header.Elements = IROp->Elements;
+          NewOp->Header.NumArgs = IROp->NumArgs;
+          NewOp->Header.HasDest = IROp->HasDest;
+          NewOp->Syscall = Constant;
+
+          for (uint8_t i = 0; i < IROp->NumArgs; ++i) {
+            NewOp->Header.Args[i] = IROp->Args[i];
+          }
+
+          Disp->ReplaceAllUsesWith(CodeNode, &NewOp->Header);
+          Changed = true;
         }
-
       }
 
       // CodeLast is inclusive. So we still need to dump the CodeLast op as well
@@ -0,0 +1,127 @@
+#include "Interface/IR/PassManager.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include <iostream>
+#include <unordered_map>
+
+namespace FEXCore::IR::Validation {
+
+/**
+ * @brief Checks that the use counts, and the use lists if a pass has built them, match the arguments in the IR
+ *
+ * Runs in between the optimization passes since those are what edit uses.
+ * The compaction pass replaces the IR and drops the use lists, so running it at the end wouldn't check the lists.
+ */
+class UseListValidation final : public FEXCore::IR::Pass {
+public:
+  bool Run(OpDispatchBuilder *Disp) override;
+};
+
+bool UseListValidation::Run(OpDispatchBuilder *Disp) {
+  bool HadError = false;
+  auto CurrentIR = Disp->ViewIR();
+  uintptr_t ListBegin = CurrentIR.GetListData();
+  uintptr_t DataBegin = CurrentIR.GetData();
+
+  std::ostringstream Errors;
+
+  auto Begin = CurrentIR.begin();
+  auto Op = Begin();
+
+  OrderedNode *RealNode = Op->GetNode(ListBegin);
+  auto HeaderOp = RealNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+  LogMan::Throw::A(HeaderOp->Header.Op == OP_IRHEADER, "First op wasn't IRHeader");
+
+  // How many times each node shows up as a used argument of a live op
+  std::unordered_map<uint32_t, uint32_t> ExpectedUses;
+  std::vector<OrderedNode*> Values;
+
+  OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+  while (1) {
+    auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    LogMan::Throw::A(BlockIROp->Header.Op == OP_CODEBLOCK, "IR type failed to be a code block");
+
+    // We grab these nodes this way so we can iterate easily
+    auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+    auto CodeLast = CurrentIR.at(BlockIROp->Last);
+
+    while (1) {
+      auto CodeOp = CodeBegin();
+      OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+
+      Disp->ForEachUsedArg(CodeNode, [&](OrderedNode *Arg) {
+        ++ExpectedUses[Arg->Wrapped(ListBegin).ID()];
+      });
+
+      if (CodeNode->Op(DataBegin)->HasDest) {
+        Values.emplace_back(CodeNode);
+      }
+
+      // CodeLast is inclusive. So we still need to check the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+
+    if (BlockIROp->Next.ID() == 0) {
+      break;
+    } else {
+      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+    }
+  }
+
+  bool CheckLists = Disp->HasUseLists();
+
+  for (auto Value : Values) {
+    uint32_t ID = Value->Wrapped(ListBegin).ID();
+    uint32_t Expected = ExpectedUses[ID];
+
+    if (Value->GetUses() != Expected) {
+      HadError |= true;
+      Errors << "%ssa" << ID << ": Has a use count of " << Value->GetUses() << " but is used " << Expected << " times" << std::endl;
+    }
+
+    if (!CheckLists) {
+      continue;
+    }
+
+    uint32_t ListUses = 0;
+    Disp->ForEachUser(Value, [&](OrderedNode *User) {
+      ++ListUses;
+
+      bool UsesValue = false;
+      Disp->ForEachUsedArg(User, [&](OrderedNode *Arg) {
+        UsesValue |= Arg == Value;
+      });
+
+      if (!UsesValue) {
+        HadError |= true;
+        Errors << "%ssa" << ID << ": Use list has %ssa" << User->Wrapped(ListBegin).ID() << " which doesn't use it" << std::endl;
+      }
+    });
+
+    if (ListUses != Expected) {
+      HadError |= true;
+      Errors << "%ssa" << ID << ": Use list has " << ListUses << " entries but is used " << Expected << " times" << std::endl;
+    }
+  }
+
+  if (HadError) {
+    std::stringstream Out;
+    FEXCore::IR::Dump(&Out, &CurrentIR);
+
+    Out << "Errors:" << std::endl << Errors.str() << std::endl;
+
+    std::cerr << Out.str() << std::endl;
+    LogMan::Msg::A("Use counts and use lists are out of sync with the IR");
+  }
+
+  return false;
+}
+
+FEXCore::IR::Pass* CreateUseListValidation() {
+  return new UseListValidation{};
+}
+
+}
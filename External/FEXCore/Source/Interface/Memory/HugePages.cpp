@@ -0,0 +1,48 @@
+#include "LogManager.h"
+#include "Common/MathUtils.h"
+#include "Interface/Memory/HugePages.h"
+
+#include <sys/mman.h>
+
+namespace FEXCore::Memory {
+  void AdviseHugePages(void *Ptr, size_t Size) {
+    uintptr_t Begin = AlignUp(reinterpret_cast<uintptr_t>(Ptr), HUGE_PAGE_SIZE);
+    uintptr_t End = AlignDown(reinterpret_cast<uintptr_t>(Ptr) + Size, HUGE_PAGE_SIZE);
+    if (Begin >= End) {
+      return;
+    }
+
+    if (madvise(reinterpret_cast<void*>(Begin), End - Begin, MADV_HUGEPAGE) != 0) {
+      LogMan::Msg::D("Couldn't use huge pages for [0x%lx, 0x%lx)", Begin, End);
+    }
+  }
+
+  void *AllocateHugePages(size_t Size) {
+    Size = AlignUp(Size, HUGE_PAGE_SIZE);
+
+    void *Ptr = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (Ptr != MAP_FAILED) {
+      return Ptr;
+    }
+
+    // No hugetlbfs pages reserved, over allocate so the range can be aligned for THP
+    void *Base = mmap(nullptr, Size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (Base == MAP_FAILED) {
+      return nullptr;
+    }
+
+    uintptr_t BasePtr = reinterpret_cast<uintptr_t>(Base);
+    uintptr_t AlignedPtr = AlignUp(BasePtr, HUGE_PAGE_SIZE);
+    if (AlignedPtr != BasePtr) {
+      munmap(Base, AlignedPtr - BasePtr);
+    }
+    munmap(reinterpret_cast<void*>(AlignedPtr + Size), (BasePtr + HUGE_PAGE_SIZE) - AlignedPtr);
+
+    AdviseHugePages(reinterpret_cast<void*>(AlignedPtr), Size);
+    return reinterpret_cast<void*>(AlignedPtr);
+  }
+
+  void FreeHugePages(void *Ptr, size_t Size) {
+    munmap(Ptr, AlignUp(Size, HUGE_PAGE_SIZE));
+  }
+}
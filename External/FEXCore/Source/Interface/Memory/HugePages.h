@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <stdint.h>
+
+namespace FEXCore::Memory {
+  constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+  /**
+   * @brief Asks the host to back the range with transparent huge pages
+   *
+   * Only the huge page aligned part of the range can be backed, hosts without THP support just ignore it
+   */
+  void AdviseHugePages(void *Ptr, size_t Size);
+
+  /**
+   * @brief Allocates read/write anonymous memory backed by huge pages
+   *
+   * Tries the hugetlbfs pool first and falls back to huge page aligned memory with THP advice
+   * The size gets rounded up to the huge page size, FreeHugePages needs the same size
+   *
+   * @return nullptr if the host is out of memory
+   */
+  void *AllocateHugePages(size_t Size);
+  void FreeHugePages(void *Ptr, size_t Size);
+}
@@ -1,11 +1,22 @@
 #include "LogManager.h"
+#include "Interface/Memory/HugePages.h"
 #include "Interface/Memory/MemMapper.h"
+#include <algorithm>
+#include <iterator>
+#include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
 namespace FEXCore::Memory {
 
+  void MemMapper::SetHugePages(bool Enable) {
+    HugePages = Enable;
+    if (HugePages) {
+      AdviseHugePages(SHM->Object.Ptr, SHM->Size);
+    }
+  }
+
   void *MemMapper::MapRegion(uint64_t Offset, size_t Size, bool Fixed) {
     return MapRegion(Offset, Size, PROT_READ | PROT_WRITE, Fixed);
   }
@@ -35,38 +46,193 @@ namespace FEXCore::Memory {
       return nullptr;
     }
 
-    MappedRegions.emplace_back(MemRegion{Ptr, Offset, Size});
+    if (HugePages) {
+      AdviseHugePages(Ptr, Size);
+    }
+
+    AddRegion(MemRegion{Ptr, Offset, Size});
 
     return Ptr;
   }
 
-  void MemMapper::UnmapRegion(void *Ptr, size_t Size) {
-    auto it = std::find(MappedRegions.begin(), MappedRegions.end(), Ptr);
-    if (it != MappedRegions.end()) {
-      munmap(Ptr, Size);
-      MappedRegions.erase(it);
+  void MemMapper::UnmapRegion(uint64_t Offset, size_t Size) {
+    uint64_t End = Offset + Size;
+    uintptr_t PtrOffset = reinterpret_cast<uintptr_t>(SHM->Object.Ptr) + Offset;
+
+    std::unique_lock<std::shared_mutex> lk(RegionMutex);
+    auto it = MappedRegions.upper_bound(Offset);
+    if (it != MappedRegions.begin()) {
+      --it;
+    }
+
+    // Regions that didn't end up at their fixed location live outside of the base mapping
+    for (; it != MappedRegions.end() && it->first < End; ++it) {
+      auto const &Region = it->second;
+      uint64_t UnmapBegin = std::max(Region.Offset, Offset);
+      uint64_t UnmapEnd = std::min(Region.Offset + Region.Size, End);
+      uintptr_t RegionPtr = reinterpret_cast<uintptr_t>(Region.Ptr) + (UnmapBegin - Region.Offset);
+      if (UnmapBegin < UnmapEnd && RegionPtr != reinterpret_cast<uintptr_t>(SHM->Object.Ptr) + UnmapBegin) {
+        munmap(reinterpret_cast<void*>(RegionPtr), UnmapEnd - UnmapBegin);
+      }
+    }
+
+    RemoveRange(Offset, Size);
+    lk.unlock();
+
+    // Replacing the mapping drops any anonymous or file pages the guest had mapped over the range
+    void *Ptr = mmap(reinterpret_cast<void*>(PtrOffset), Size, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_FIXED, SHM->SHMFD, Offset);
+    if (Ptr == MAP_FAILED) {
+      LogMan::Msg::E("Failed to reset memory region [0x%lx, 0x%lx)", Offset, End);
+      return;
+    }
+
+    if (HugePages) {
+      AdviseHugePages(Ptr, Size);
+    }
+
+    if (fallocate(SHM->SHMFD, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, Offset, Size) != 0) {
+      LogMan::Msg::D("Couldn't release memory region [0x%lx, 0x%lx)", Offset, End);
+    }
+  }
+
+  bool MemMapper::FindFreeRange(uint64_t Begin, uint64_t End, uint64_t Size, uint64_t *Offset) const {
+    std::shared_lock<std::shared_mutex> lk(RegionMutex);
+    uint64_t Candidate = Begin;
+
+    auto it = MappedRegions.upper_bound(Begin);
+    if (it != MappedRegions.begin()) {
+      auto const &Region = std::prev(it)->second;
+      Candidate = std::max(Candidate, Region.Offset + Region.Size);
     }
+
+    // Step over each region until the gap before the next one is large enough
+    for (; it != MappedRegions.end() && it->first < End; ++it) {
+      if (it->first >= Candidate + Size) {
+        break;
+      }
+      Candidate = std::max(Candidate, it->first + it->second.Size);
+    }
+
+    if (Candidate + Size > End) {
+      return false;
+    }
+
+    *Offset = Candidate;
+    return true;
   }
 
-  void *MemMapper::GetPointer(uint64_t Offset) {
-    for (auto const &Region : MappedRegions) {
-      if (Region.contains(Offset)) {
-        return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(Region.Ptr) + (Offset - Region.Offset));
+  bool MemMapper::IsRangeMapped(uint64_t Offset, uint64_t Size) const {
+    std::shared_lock<std::shared_mutex> lk(RegionMutex);
+    uint64_t End = Offset + Size;
+    uint64_t Covered = Offset;
+
+    auto it = MappedRegions.upper_bound(Offset);
+    if (it != MappedRegions.begin()) {
+      --it;
+    }
+
+    // Regions are sorted and don't overlap, any gap before the end means part of the range isn't mapped
+    for (; it != MappedRegions.end() && Covered < End; ++it) {
+      if (it->first > Covered) {
+        return false;
       }
+      Covered = std::max(Covered, it->first + it->second.Size);
     }
 
-    return nullptr;
+    return Covered >= End;
+  }
+
+  FEXCore::Memory::MemRegion const *MemMapper::FindRegion(uint64_t Offset) const {
+    // First region that starts after the offset, the one before it is the only one that can contain it
+    auto it = MappedRegions.upper_bound(Offset);
+    if (it == MappedRegions.begin()) {
+      return nullptr;
+    }
+
+    --it;
+    if (!it->second.contains(Offset)) {
+      return nullptr;
+    }
+
+    return &it->second;
+  }
+
+  void MemMapper::AddRegion(FEXCore::Memory::MemRegion const &Region) {
+    std::unique_lock<std::shared_mutex> lk(RegionMutex);
+    // A new mapping replaces anything that was mapped in its range
+    RemoveRange(Region.Offset, Region.Size);
+    MappedRegions.emplace(Region.Offset, Region);
+  }
+
+  void MemMapper::RemoveRange(uint64_t Offset, uint64_t Size) {
+    uint64_t End = Offset + Size;
+
+    auto it = MappedRegions.upper_bound(Offset);
+    if (it != MappedRegions.begin()) {
+      --it;
+    }
+
+    while (it != MappedRegions.end() && it->first < End) {
+      MemRegion Region = it->second;
+      uint64_t RegionEnd = Region.Offset + Region.Size;
+
+      if (RegionEnd <= Offset) {
+        ++it;
+        continue;
+      }
+
+      it = MappedRegions.erase(it);
+
+      // Keep the parts of the region that are outside of the range
+      if (Region.Offset < Offset) {
+        MappedRegions.emplace(Region.Offset, MemRegion{Region.Ptr, Region.Offset, Offset - Region.Offset});
+      }
+
+      if (RegionEnd > End) {
+        void *TailPtr = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(Region.Ptr) + (End - Region.Offset));
+        it = MappedRegions.emplace(End, MemRegion{TailPtr, End, RegionEnd - End}).first;
+        ++it;
+      }
+    }
+  }
+
+  void *MemMapper::GetPointer(uint64_t Offset) {
+    std::shared_lock<std::shared_mutex> lk(RegionMutex);
+    auto Region = FindRegion(Offset);
+    if (!Region) {
+      return nullptr;
+    }
+
+    return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(Region->Ptr) + (Offset - Region->Offset));
   }
 
 #ifndef NDEBUG
   void *MemMapper::GetPointerSizeCheck(uint64_t Offset, uint64_t Size) {
-    for (auto const &Region : MappedRegions) {
-      if (Region.contains(Offset)) {
-        LogMan::Throw::A((Region.Offset + Region.Size) >= (Offset + Size), "Pointer in region but region isn't large enough. Needs 0x%lx more", Offset - Region.Offset + Size - Region.Size);
-        if ((Region.Offset + Region.Size) >= (Offset + Size)) {
-          return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(Region.Ptr) + (Offset - Region.Offset));
-        }
+    std::shared_lock<std::shared_mutex> lk(RegionMutex);
+    auto it = MappedRegions.upper_bound(Offset);
+    if (it == MappedRegions.begin() || !std::prev(it)->second.contains(Offset)) {
+      return nullptr;
+    }
+
+    --it;
+    auto const &Region = it->second;
+    uint64_t End = Region.Offset + Region.Size;
+
+    // Regions that were split by later mappings can still be contiguous on the host side
+    for (auto Next = std::next(it); Next != MappedRegions.end() && End < (Offset + Size); ++Next) {
+      auto const &NextRegion = Next->second;
+      bool Contiguous = NextRegion.Offset == End &&
+        reinterpret_cast<uintptr_t>(NextRegion.Ptr) == reinterpret_cast<uintptr_t>(Region.Ptr) + (End - Region.Offset);
+      if (!Contiguous) {
+        break;
       }
+      End += NextRegion.Size;
+    }
+
+    LogMan::Throw::A(End >= (Offset + Size), "Pointer in region but region isn't large enough. Needs 0x%lx more", Offset + Size - End);
+    if (End >= (Offset + Size)) {
+      return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(Region.Ptr) + (Offset - Region.Offset));
     }
     return nullptr;
   }
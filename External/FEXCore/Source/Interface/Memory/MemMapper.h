@@ -1,8 +1,10 @@
 #pragma once
 #include "Interface/Memory/SharedMem.h"
 #include <FEXCore/Memory/MemMapper.h>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
 #include <stdint.h>
-#include <vector>
 
 namespace FEXCore::Context {
 struct Context;
@@ -20,11 +22,33 @@ namespace FEXCore::Memory {
       return SHM->Size;
     }
 
+    // Advises huge pages for the base mapping and every region mapped afterwards
+    void SetHugePages(bool Enable);
+
     void *MapRegion(uint64_t Offset, size_t Size, bool Fixed = true);
     void *MapRegion(uint64_t Offset, size_t Size, uint32_t Flags, bool Fixed = true);
     void *ChangeMappedRegion(uint64_t Offset, size_t Size, uint32_t Flags, bool Fixed = true);
 
-    void UnmapRegion(void *Ptr, size_t Size);
+    /**
+     * @brief Releases the guest range
+     *
+     * The host range stays reserved by the base mapping and the SHM pages backing it are freed
+     * Anything mapped in the range afterwards starts out zeroed
+     */
+    void UnmapRegion(uint64_t Offset, size_t Size);
+
+    /**
+     * @brief Finds the first unmapped range of Size bytes inside of [Begin, End)
+     *
+     * @return true if a range was found, Offset is set to its start
+     */
+    bool FindFreeRange(uint64_t Begin, uint64_t End, uint64_t Size, uint64_t *Offset) const;
+
+    // Checks that every byte of [Offset, Offset + Size) is covered by a tracked region
+    bool IsRangeMapped(uint64_t Offset, uint64_t Size) const;
+
+    // Tracks a guest range that is already backed by host memory
+    void AddRegion(FEXCore::Memory::MemRegion const &Region);
 
     void *GetMemoryBase() { return SHM->Object.Ptr; }
 
@@ -45,8 +69,16 @@ namespace FEXCore::Memory {
     }
 
   private:
+    FEXCore::Memory::MemRegion const *FindRegion(uint64_t Offset) const;
+    // Removes the range from the tracked regions, splitting any region that only partially overlaps
+    void RemoveRange(uint64_t Offset, uint64_t Size);
+
     FEXCore::SHM::InternalSHMObject *SHM;
-    std::vector<FEXCore::Memory::MemRegion> MappedRegions{};
+    bool HugePages{};
+    // Lookups take it shared, anything that changes the regions takes it unique
+    mutable std::shared_mutex RegionMutex;
+    // Non-overlapping regions keyed by guest offset
+    std::map<uint64_t, FEXCore::Memory::MemRegion> MappedRegions{};
   };
 }
 
@@ -14,6 +14,10 @@ namespace FEXCore::Config {
     CONFIG_ACCURATESTDOUT,
     CONFIG_ROOTFSPATH,
     CONFIG_UNIFIED_MEMORY,
+    CONFIG_JITSTATSPATH,
+    CONFIG_HOSTFEATURES,
+    CONFIG_HUGEPAGES,
+    CONFIG_ENTRYCACHE,
   };
 
   enum ConfigCore {
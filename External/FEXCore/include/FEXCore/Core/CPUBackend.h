@@ -1,6 +1,7 @@
 #pragma once
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 namespace FEXCore {
 
@@ -45,6 +46,38 @@ class LLVMCore;
      */
     virtual void *CompileCode(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData) = 0;
 
+    struct BatchBlock {
+      FEXCore::IR::IRListView<true> const *IR;
+      FEXCore::Core::DebugData *DebugData;
+      // Filled in by the backend, nullptr if the block couldn't be compiled
+      void *CodePtr;
+    };
+
+    /**
+     * @brief Lets FEXCore know if this CPUBackend can compile blocks in batches through CompileCodeBatch
+     *
+     * The IR of every block in a batch is generated before any of them are compiled
+     * Backends that read register allocation results while compiling can't batch, those only describe the last IR generated
+     *
+     * @return true if CompileCodeBatch can be used
+     */
+    virtual bool HasBatchCompile() const { return false; }
+
+    /**
+     * @brief Compiles multiple blocks at once
+     *
+     * Backends that have a large fixed cost per compile can override this to share that cost between all of the blocks
+     * By default each block is compiled on its own through CompileCode
+     * Only used if HasBatchCompile returns true
+     *
+     * @param Blocks - Blocks to compile, CodePtr is filled in for every block
+     */
+    virtual void CompileCodeBatch(std::vector<BatchBlock> &Blocks) {
+      for (auto &Block : Blocks) {
+        Block.CodePtr = CompileCode(Block.IR, Block.DebugData);
+      }
+    }
+
     /**
      * @brief Function for mapping memory in to the CPUBackend's visible space. Allows setting up virtual mappings if required
      *
@@ -52,6 +85,13 @@ class LLVMCore;
      */
     virtual void *MapRegion(void *HostPtr, uint64_t GuestPtr, uint64_t Size) = 0;
 
+    /**
+     * @brief Drops anything the backend has cached for guest code that starts in [Address, Address + Size)
+     *
+     * Called when the guest memory backing that code gets discarded
+     */
+    virtual void InvalidateGuestCodeRange(uint64_t Address, uint64_t Size) {}
+
     /**
      * @brief This is post-setup initialization that is called just before code executino
      *
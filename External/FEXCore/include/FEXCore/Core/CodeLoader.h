@@ -73,6 +73,24 @@ public:
   using MemoryWriter = std::function<void(void const*, uint64_t, uint64_t)>;
   virtual void LoadMemory(MemoryWriter Writer) = 0;
 
+  /**
+   * @brief File mapper function for mapping file backed code directly in to guest memory
+   *
+   * First argument = File descriptor
+   * Second argument = Page aligned file offset
+   * Third argument = Page aligned guest memory location
+   * Fourth argument = Page aligned size
+   *
+   * @return false if the range couldn't be mapped, the loader needs to write it instead
+   */
+  using FileMapper = std::function<bool(int, uint64_t, uint64_t, uint64_t)>;
+  /**
+   * @brief Loads code in to guest memory, mapping what it can from files instead of copying
+   *
+   * Loaders without a backing file just write everything
+   */
+  virtual void LoadMappedMemory(MemoryWriter Writer, FileMapper Mapper) { LoadMemory(Writer); }
+
   /**
    * @brief Get the final RIP we are supposed to end up on in a debugger
    *
@@ -4,8 +4,13 @@
 #include <FEXCore/Core/CPUBackend.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 #include <FEXCore/Utils/Event.h>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace FEXCore {
   class BlockCache;
@@ -20,9 +25,30 @@ namespace FEXCore::IR{
 
 namespace FEXCore::Core {
 
+  /**
+   * @brief Accumulated cost of a single pass in the PassManager
+   *
+   * Node counts are live IR nodes summed over every run of the pass
+   */
+  struct PassStats {
+    std::string Name;
+    uint64_t Runs;
+    uint64_t Time; ///< Nanoseconds spent in the pass
+    uint64_t NodesBefore;
+    uint64_t NodesAfter;
+  };
+
   struct RuntimeStats {
     std::atomic_uint64_t InstructionsExecuted;
     std::atomic_uint64_t BlocksCompiled;
+
+    // Nanoseconds spent in each phase of compiling a block
+    // Only gathered when JIT stats are enabled
+    std::atomic_uint64_t DecodeTime;
+    std::atomic_uint64_t DispatchTime;
+    std::atomic_uint64_t PassManagerTime;
+    std::atomic_uint64_t BackendTime;
+    std::vector<PassStats> Passes;
   };
 
   /**
@@ -38,6 +64,29 @@ namespace FEXCore::Core {
     uint64_t RunCount; ///< Number of times this block of code has been run
   };
 
+  /**
+   * @brief IR that any number of RIPs can share
+   *
+   * RIP relative values in the IR are calculated from the RIP the block was entered at.
+   * Guest code that is identical at different RIPs generates identical IR, which only needs to be compiled once.
+   */
+  struct SharedBlock {
+    std::shared_ptr<FEXCore::IR::IRListView<true>> IR;
+    uint64_t RIP; ///< The RIP the IR was first generated at
+    void *CodePtr; ///< Host code compiled from the IR, nullptr until the backend has compiled it
+    std::vector<uint64_t> RIPs; ///< Every RIP that has been handed the IR, these all map to CodePtr once it is compiled
+  };
+
+  /**
+   * @brief Guest code a block's IR was generated from, [Begin, End)
+   *
+   * Multiblock IR can contain code before the block's RIP as well as after it
+   */
+  struct GuestCodeRange {
+    uint64_t Begin;
+    uint64_t End;
+  };
+
   struct InternalThreadState {
     FEXCore::Core::ThreadState State;
 
@@ -46,6 +95,8 @@ namespace FEXCore::Core {
     std::thread ExecutionThread;
     Event StartRunning;
     Event ThreadWaiting;
+    // Wakes the parked host thread of an exited guest thread once the object gets recycled
+    Event ReuseThread;
 
     std::unique_ptr<FEXCore::IR::OpDispatchBuilder> OpDispatcher;
 
@@ -54,11 +105,24 @@ namespace FEXCore::Core {
 
     std::unique_ptr<FEXCore::BlockCache> BlockCache;
 
-    std::map<uint64_t, std::unique_ptr<FEXCore::IR::IRListView<true>>> IRLists;
+    std::map<uint64_t, std::shared_ptr<FEXCore::IR::IRListView<true>>> IRLists;
+    // Keyed by a hash of the IR's contents
+    std::unordered_map<uint64_t, SharedBlock> SharedBlocks;
+    // Hash of the shared block each RIP is using
+    std::unordered_map<uint64_t, uint64_t> SharedBlockHashes;
     std::map<uint64_t, FEXCore::Core::DebugData> DebugData;
+    // Keyed by the block's RIP
+    std::map<uint64_t, GuestCodeRange> GuestCodeRanges;
+    // Largest End - Begin of any GuestCodeRange, bounds how far from a range the RIP of an overlapping block can be
+    uint64_t MaxGuestCodeRangeSize {};
     RuntimeStats Stats{};
 
     FEXCore::Context::ExitReason ExitReason {FEXCore::Context::ExitReason::EXIT_WAITING};
+
+    // Set once the backends are initialized and the entry list is compiled, survives the thread object being recycled
+    bool Initialized {false};
+    // Set when the guest thread has exited by itself and its host thread is parked. The next thread that gets created takes over both
+    std::atomic_bool Exited {false};
   };
 }
 
@@ -332,6 +332,7 @@ struct CondClassType final {
 #define IROP_ENUM
 #define IROP_STRUCTS
 #define IROP_SIZES
+#define IROP_PROPERTIES
 #include <FEXCore/IR/IRDefines.inc>
 
 template<bool>
@@ -1,9 +1,13 @@
 #include <SonicUtils/ELFLoader.h>
 #include <SonicUtils/LogManager.h>
+#include <SonicUtils/Common/MathUtils.h>
 #include <cstring>
 #include <elf.h>
-#include <fstream>
+#include <fcntl.h>
 #include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <vector>
 
 namespace ELFLoader {
@@ -50,28 +54,45 @@ ELFContainer::~ELFContainer() {
   Symbols.clear();
   ProgramHeaders.clear();
   SectionHeaders.clear();
-  RawFile.clear();
+
+  if (RawFile.Data) {
+    munmap(RawFile.Data, RawFile.Size);
+  }
+
+  if (FD != -1) {
+    close(FD);
+  }
 }
 
 bool ELFContainer::LoadELF(std::string const &Filename) {
-  std::fstream ELFFile;
-  size_t FileSize{0};
-  ELFFile.open(Filename, std::fstream::in | std::fstream::binary);
-
-  if (!ELFFile.is_open())
+  int NewFD = open(Filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (NewFD == -1)
     return false;
 
-  LogMan::Throw::A(ELFFile.is_open(), "Failed to open file");
+  struct stat Stat{};
+  if (fstat(NewFD, &Stat) != 0 || Stat.st_size == 0) {
+    close(NewFD);
+    return false;
+  }
 
-  ELFFile.seekg(0, ELFFile.end);
-  FileSize = ELFFile.tellg();
-  ELFFile.seekg(0, ELFFile.beg);
+  void *Data = mmap(nullptr, Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, NewFD, 0);
+  if (Data == MAP_FAILED) {
+    close(NewFD);
+    return false;
+  }
 
-  RawFile.resize(FileSize);
+  // Replacing an ELF with its interpreter drops the original file
+  if (RawFile.Data) {
+    munmap(RawFile.Data, RawFile.Size);
+  }
 
-  ELFFile.read(&RawFile.at(0), FileSize);
+  if (FD != -1) {
+    close(FD);
+  }
 
-  ELFFile.close();
+  RawFile.Data = reinterpret_cast<char*>(Data);
+  RawFile.Size = Stat.st_size;
+  FD = NewFD;
 
   InterpreterHeader = nullptr;
 
@@ -119,6 +140,43 @@ void ELFContainer::WriteLoadableSections(MemoryWriter Writer, uint64_t Offset) {
   }
 }
 
+void ELFContainer::MapLoadableSections(MemoryWriter Writer, FileMapper Mapper, uint64_t Offset) {
+  constexpr uint64_t PAGE_SIZE = 4096;
+
+  for (uint32_t i = 0; i < ProgramHeaders.size(); ++i) {
+    Elf64_Phdr const *hdr = ProgramHeaders.at(i);
+    if (hdr->p_type == PT_LOAD) {
+      uint64_t Physical = Offset + hdr->p_paddr;
+
+      // Only whole pages that are entirely inside of the section get mapped
+      // Edge pages can be shared with another section, and file contents past p_filesz must not leak in to .bss
+      uint64_t MapBegin = AlignUp(Physical, PAGE_SIZE);
+      uint64_t MapEnd = AlignDown(Physical + hdr->p_filesz, PAGE_SIZE);
+      uint64_t FileOffset = hdr->p_offset + (MapBegin - Physical);
+
+      bool Mapped = MapBegin < MapEnd &&
+        (FileOffset % PAGE_SIZE) == 0 &&
+        Mapper(FD, FileOffset, MapBegin, MapEnd - MapBegin);
+
+      if (Mapped) {
+        if (MapBegin != Physical) {
+          Writer(&RawFile.at(hdr->p_offset), Physical, MapBegin - Physical);
+        }
+        if (MapEnd != Physical + hdr->p_filesz) {
+          Writer(&RawFile.at(hdr->p_offset + (MapEnd - Physical)), MapEnd, (Physical + hdr->p_filesz) - MapEnd);
+        }
+      }
+      else {
+        Writer(&RawFile.at(hdr->p_offset), Physical, hdr->p_filesz);
+      }
+    }
+
+    if (hdr->p_type == PT_TLS) {
+      Writer(&RawFile.at(hdr->p_offset), Offset + hdr->p_paddr, hdr->p_filesz);
+    }
+  }
+}
+
 uint64_t ELFContainer::InitializeThreadSlot(void *ELFBase, std::function<void(void const*, uint64_t)> Writer) const {
   Writer(reinterpret_cast<void const*>(reinterpret_cast<uint64_t>(ELFBase) + TLSHeader->p_paddr), TLSHeader->p_memsz);
   return TLSHeader->p_memsz;
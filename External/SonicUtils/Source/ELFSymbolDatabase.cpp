@@ -233,6 +233,18 @@ void ELFSymbolDatabase::WriteLoadableSections(::ELFLoader::ELFContainer::MemoryW
   HandleRelocations();
 }
 
+void ELFSymbolDatabase::MapLoadableSections(::ELFLoader::ELFContainer::MemoryWriter Writer, ::ELFLoader::ELFContainer::FileMapper Mapper) {
+  File->MapLoadableSections(Writer, Mapper, std::get<0>(LocalInfo.CustomLayout) - std::get<0>(File->GetLayout()));
+  for (size_t i = 0; i < DynamicELFInfo.size(); ++i) {
+    auto ELF = DynamicELFInfo[i]->Container;
+    auto &Layout = DynamicELFInfo[i]->CustomLayout;
+
+    ELF->MapLoadableSections(Writer, Mapper, std::get<0>(Layout) - std::get<0>(ELF->GetLayout()));
+  }
+
+  HandleRelocations();
+}
+
 void ELFSymbolDatabase::HandleRelocations() {
   auto SymbolGetter = [this](char const *SymbolName, uint8_t Table) -> ELFLoader::ELFSymbol* {
     SymbolTableType &TablePtr = SymbolMap;
@@ -3,6 +3,7 @@
 #include <elf.h>
 #include <functional>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -24,6 +25,9 @@ public:
   ELFContainer(std::string const &Filename, bool CustomInterpreter);
   ~ELFContainer();
 
+  ELFContainer(ELFContainer const&) = delete;
+  ELFContainer &operator=(ELFContainer const&) = delete;
+
   uint64_t GetEntryPoint() const { return Header.e_entry; }
 
   using MemoryLayout = std::tuple<uint64_t, uint64_t, uint64_t>;
@@ -37,6 +41,16 @@ public:
   using MemoryWriter = std::function<void(void *, uint64_t, uint64_t)>;
   void WriteLoadableSections(MemoryWriter Writer, uint64_t Offset = 0);
 
+  // File descriptor, File offset, Physical, Size
+  // Returns false if the range couldn't be mapped
+  using FileMapper = std::function<bool(int, uint64_t, uint64_t, uint64_t)>;
+  /**
+   * @brief Maps the page aligned parts of the loadable sections directly from the file
+   *
+   * Partial pages at the edges of a section and sections that can't be mapped go through the writer instead
+   */
+  void MapLoadableSections(MemoryWriter Writer, FileMapper Mapper, uint64_t Offset = 0);
+
   ELFSymbol const *GetSymbol(char const *Name);
   ELFSymbol const *GetSymbol(uint64_t Address);
 
@@ -75,7 +89,21 @@ private:
   void PrintInitArray() const;
   void PrintDynamicTable() const;
 
-  std::vector<char> RawFile;
+  // Private mapping of the file, pages are shared with the page cache until something writes to them
+  struct MappedFile {
+    char *Data{};
+    size_t Size{};
+
+    char &at(size_t Offset) const {
+      if (Offset >= Size) {
+        throw std::out_of_range("ELF file offset out of range");
+      }
+      return Data[Offset];
+    }
+  };
+
+  MappedFile RawFile;
+  int FD{-1};
   Elf64_Ehdr Header;
   std::vector<Elf64_Shdr*> SectionHeaders;
   std::vector<Elf64_Phdr*> ProgramHeaders;
@@ -13,6 +13,7 @@ public:
 
   void MapMemoryRegions(std::function<void*(uint64_t, uint64_t)> Mapper);
   void WriteLoadableSections(::ELFLoader::ELFContainer::MemoryWriter Writer);
+  void MapLoadableSections(::ELFLoader::ELFContainer::MemoryWriter Writer, ::ELFLoader::ELFContainer::FileMapper Mapper);
 
   uint64_t DefaultRIP() const;
 
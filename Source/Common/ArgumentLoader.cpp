@@ -54,6 +54,10 @@ namespace FEX::ArgLoader {
         .dest("GdbServer")
         .action("store_true")
         .help("Enables the GDB server");
+    CPUGroup.add_option("--no-host-features")
+        .dest("HostFeatures")
+        .action("store_false")
+        .help("Only emit baseline instructions in the JIT, ignoring host instruction set extensions");
 
       Parser.add_option_group(CPUGroup);
     }
@@ -79,6 +83,20 @@ namespace FEX::ArgLoader {
         .action("store_true")
         .help("Enable unified memory for the emulator");
 
+      EmulationGroup.add_option("--huge-pages")
+        .dest("HugePages")
+        .action("store_true")
+        .help("Back guest memory and JIT code with huge pages when the host supports them");
+
+      EmulationGroup.add_option("--entry-cache")
+        .dest("EntryCache")
+        .action("store_true")
+        .help("Compile the blocks previous runs of the application executed on startup");
+
+      EmulationGroup.add_option("--jit-stats")
+        .dest("JITStats")
+        .help("Write per thread JIT compile time statistics as JSON to this file on exit");
+
       Parser.add_option_group(EmulationGroup);
     }
     {
@@ -152,6 +170,11 @@ namespace FEX::ArgLoader {
         bool GdbServer = Options.get("GdbServer");
         Config::Add("GdbServer", std::to_string(GdbServer));
       }
+
+      if (Options.is_set_by_user("HostFeatures")) {
+        bool HostFeatures = Options.get("HostFeatures");
+        Config::Add("HostFeatures", std::to_string(HostFeatures));
+      }
     }
 
     {
@@ -169,6 +192,21 @@ namespace FEX::ArgLoader {
         bool Option = Options.get("UnifiedMemory");
         Config::Add("UnifiedMemory", std::to_string(Option));
       }
+
+      if (Options.is_set_by_user("HugePages")) {
+        bool Option = Options.get("HugePages");
+        Config::Add("HugePages", std::to_string(Option));
+      }
+
+      if (Options.is_set_by_user("EntryCache")) {
+        bool Option = Options.get("EntryCache");
+        Config::Add("EntryCache", std::to_string(Option));
+      }
+
+      if (Options.is_set_by_user("JITStats")) {
+        std::string Option = Options["JITStats"];
+        Config::Add("JITStats", Option);
+      }
     }
 
     {
@@ -68,6 +68,10 @@ int main(int argc, char **argv, char **const envp) {
   FEX::Config::Value<bool> AccurateSTDConfig{"AccurateSTDOut", false};
   FEX::Config::Value<bool> UnifiedMemory{"UnifiedMemory", false};
   FEX::Config::Value<std::string> LDPath{"RootFS", ""};
+  FEX::Config::Value<std::string> JITStatsPath{"JITStats", ""};
+  FEX::Config::Value<bool> HostFeaturesConfig{"HostFeatures", true};
+  FEX::Config::Value<bool> HugePagesConfig{"HugePages", false};
+  FEX::Config::Value<bool> EntryCacheConfig{"EntryCache", false};
 
   auto Args = FEX::ArgLoader::Get();
 
@@ -90,6 +94,10 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_GDBSERVER, GdbServerConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_ROOTFSPATH, LDPath());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_UNIFIED_MEMORY, UnifiedMemory());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_JITSTATSPATH, JITStatsPath());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HOSTFEATURES, HostFeaturesConfig());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HUGEPAGES, HugePagesConfig());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_ENTRYCACHE, EntryCacheConfig());
   FEXCore::Context::SetCustomCPUBackendFactory(CTX, VMFactory::CPUCreationFactory);
   // FEXCore::Context::SetFallbackCPUBackendFactory(CTX, VMFactory::CPUCreationFactoryFallback);
 
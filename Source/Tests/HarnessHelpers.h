@@ -574,6 +574,10 @@ public:
     DB.WriteLoadableSections(Writer);
   }
 
+  void LoadMappedMemory(MemoryWriter Writer, FileMapper Mapper) override {
+    DB.MapLoadableSections(Writer, Mapper);
+  }
+
   char const *FindSymbolNameInRange(uint64_t Address) override {
     ELFLoader::ELFSymbol const *Sym;
     Sym = DB.GetSymbolInRange(std::make_pair(Address, 1));
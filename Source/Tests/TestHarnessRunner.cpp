@@ -58,6 +58,8 @@ int main(int argc, char **argv) {
   FEX::Config::Value<uint64_t> BlockSizeConfig{"MaxInst", 1};
   FEX::Config::Value<bool> SingleStepConfig{"SingleStep", false};
   FEX::Config::Value<bool> MultiblockConfig{"Multiblock", false};
+  FEX::Config::Value<bool> HostFeaturesConfig{"HostFeatures", true};
+  FEX::Config::Value<bool> HugePagesConfig{"HugePages", false};
 
   auto Args = FEX::ArgLoader::Get();
 
@@ -72,6 +74,8 @@ int main(int argc, char **argv) {
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_MULTIBLOCK, MultiblockConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_SINGLESTEP, SingleStepConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_MAXBLOCKINST, BlockSizeConfig());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HOSTFEATURES, HostFeaturesConfig());
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HUGEPAGES, HugePagesConfig());
   FEXCore::Context::SetCustomCPUBackendFactory(CTX, VMFactory::CPUCreationFactory);
 
   FEXCore::Context::AddGuestMemoryRegion(CTX, SHM);
@@ -0,0 +1,36 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RCX": "0x2",
+    "RSI": "0xE8000006",
+    "RDI": "0xE800000E",
+    "R8":  "0x1",
+    "R9":  "0x0"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe8000000
+mov rax, 0x4142434445464748
+mov [rdx], rax
+mov rax, 0x4142FF4445464748
+mov [rdx + 8], rax
+
+lea rsi, [rdx]
+lea rdi, [rdx + 8]
+mov rcx, 8
+cld
+
+; Stops on the sixth byte, 0x43 - 0xFF
+repe cmpsb
+
+mov r8, 0
+mov r9, 0
+setc r8b
+setz r9b
+
+hlt
@@ -0,0 +1,33 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x23456789ABCDEF01",
+    "RBX": "0xDEF0123456789ABC",
+    "RCX": "0x18",
+    "RDX": "0x20",
+    "RSI": "0x4",
+    "RDI": "0x40",
+    "R8": "0x37"
+  }
+}
+%endif
+
+; Rotates by an immediate
+mov rax, 0x0123456789ABCDEF
+rol rax, 8
+mov rbx, 0x0123456789ABCDEF
+ror rbx, 12
+mov ecx, 0x80000001
+rol ecx, 4
+
+; Bit counting
+mov rdx, 0x0123456789ABCDEF
+popcnt rdx, rdx
+mov rsi, 0xF0
+tzcnt rsi, rsi
+mov rdi, 0
+tzcnt rdi, rdi
+mov r8, 0x00F0000000000000
+bsr r8, r8
+
+hlt
@@ -0,0 +1,49 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x41424344577A9DD0",
+    "RBX": "0x7FFF005A",
+    "RCX": "0x3456789ABCDEF000",
+    "RDX": "0x1FDB97530ECA8642",
+    "RSI": "0xFF00000000000000",
+    "RDI": "0xFFFFFFFFFFFFFFFE",
+    "R8": "0x80000001",
+    "R9": "0x80000000"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0xe8001000
+
+; ALU ops with imm8 and sign extended imm32 operands
+mov rax, 0x4142434445464748
+add rax, 0x10
+sub rax, -0x12345678
+
+mov rbx, -1
+and rbx, 0x7FFF0000
+or rbx, 0x0F
+xor rbx, 0x55
+
+; Shifts by an immediate
+mov rcx, 0x0123456789ABCDEF
+shl rcx, 12
+mov rdx, 0xFEDCBA9876543210
+shr rdx, 3
+mov rsi, 0x8000000000000000
+sar rsi, 7
+
+; Stores of immediates
+mov qword [rsp - 8], -2
+mov rdi, [rsp - 8]
+
+mov dword [rsp - 16], 0x80000001
+mov r8d, [rsp - 16]
+mov byte [rsp - 16], 0
+mov r9d, [rsp - 16]
+
+hlt
@@ -0,0 +1,41 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x1A6D",
+    "RBX": "0x2AC2",
+    "RCX": "0x0",
+    "RDX": "0x2AC2",
+    "R8": "0x100",
+    "R9": "0x1400",
+    "R10": "0xC8",
+    "R13": "0x103"
+  }
+}
+%endif
+
+mov rax, 0
+mov rbx, 1
+mov rcx, 20
+mov r8, 0x100
+mov r11, 0x3
+mov r12, 0x7
+xor r9, r9
+xor r10, r10
+
+; rax and rbx carry values around the back-edge
+; r8, r11 and r12 are defined before the loop and read in every iteration
+.loop:
+lea rdx, [rax + rbx]
+mov rax, rbx
+mov rbx, rdx
+add r9, r8
+add r10, r11
+add r10, r12
+dec rcx
+jnz .loop
+
+; r8 and r11 are still live after the loop
+lea r13, [r8 + r11]
+
+hlt
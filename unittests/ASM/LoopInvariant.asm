@@ -0,0 +1,31 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0xB6080",
+    "RBX": "0x1234",
+    "RCX": "0x0",
+    "RDX": "0xBBEE",
+    "RSI": "0x12340",
+    "RDI": "0x12CB"
+  }
+}
+%endif
+
+mov rbx, 0x1234
+mov rcx, 10
+xor rax, rax
+xor rdx, rdx
+
+; rsi and rdi only depend on rbx, which the loop never writes
+.loop:
+mov rsi, rbx
+shl rsi, 4
+mov rdi, rbx
+xor rdi, 0xFF
+add rax, rsi
+add rdx, rdi
+dec rcx
+jnz .loop
+
+hlt
@@ -0,0 +1,56 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x0",
+    "RBX": "0x0",
+    "RCX": "0x0",
+    "RDX": "0x43"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0xe8001000
+
+; mmap(nullptr, 0x2000, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+mov rax, 9
+mov rdi, 0
+mov rsi, 0x2000
+mov rdx, 3
+mov r10, 0x22
+mov r8, -1
+mov r9, 0
+syscall
+mov r12, rax
+
+mov qword [r12], 0x41
+mov qword [r12 + 0x1000], 0x42
+
+; madvise(r12, 0x1000, MADV_DONTNEED) zeroes the first page only
+mov rax, 28
+mov rdi, r12
+mov rsi, 0x1000
+mov rdx, 4
+syscall
+mov rbx, rax
+
+mov r13, [r12]
+mov r14, [r12 + 0x1000]
+
+; madvise(r12, 0x2000, MADV_WILLNEED) is passed through
+mov rax, 28
+mov rdi, r12
+mov rsi, 0x2000
+mov rdx, 3
+syscall
+mov r15, rax
+
+mov rax, r15
+mov rcx, r13
+mov rdx, r14
+inc rdx
+
+hlt
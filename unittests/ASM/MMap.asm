@@ -0,0 +1,69 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x0",
+    "RBX": "0x0",
+    "RCX": "0x0",
+    "RDX": "0x0",
+    "RSI": "0x1"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0xe8001000
+
+; mmap(nullptr, 0x2000, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+mov rax, 9
+mov rdi, 0
+mov rsi, 0x2000
+mov rdx, 3
+mov r10, 0x22
+mov r8, -1
+mov r9, 0
+syscall
+mov r12, rax
+
+mov qword [r12], 0x41
+mov qword [r12 + 0x1000], 0x42
+
+; munmap(r12, 0x2000)
+mov rax, 11
+mov rdi, r12
+mov rsi, 0x2000
+syscall
+mov rbx, rax
+
+; Mapping the same size again reuses the hole and is zeroed
+mov rax, 9
+mov rdi, 0
+mov rsi, 0x2000
+mov rdx, 3
+mov r10, 0x22
+mov r8, -1
+mov r9, 0
+syscall
+mov r13, rax
+mov r14, [r13 + 0x1000]
+
+; mremap(r13, 0x2000, 0x4000, 0) grows in place
+mov rax, 25
+mov rdi, r13
+mov rsi, 0x2000
+mov rdx, 0x4000
+mov r10, 0
+syscall
+mov r15, rax
+mov qword [r13 + 0x3000], 1
+mov rsi, [r13 + 0x3000]
+
+mov rcx, r13
+sub rcx, r12
+mov rdx, r14
+mov rax, r15
+sub rax, r13
+
+hlt
@@ -0,0 +1,59 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x22",
+    "RBX": "0x11",
+    "RCX": "0x0"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0xe8001000
+
+; mmap(nullptr, 0x1000, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+mov rax, 9
+mov rdi, 0
+mov rsi, 0x1000
+mov rdx, 7
+mov r10, 0x22
+mov r8, -1
+mov r9, 0
+syscall
+mov r12, rax
+
+; mov eax, 0x11; ret
+mov dword [r12], 0x000011B8
+mov word [r12 + 4], 0xC300
+call r12
+mov rbx, rax
+
+; munmap(r12, 0x1000)
+mov rax, 11
+mov rdi, r12
+mov rsi, 0x1000
+syscall
+
+; Mapping the same size again reuses the hole, the code compiled from the old mapping must not run
+mov rax, 9
+mov rdi, 0
+mov rsi, 0x1000
+mov rdx, 7
+mov r10, 0x22
+mov r8, -1
+mov r9, 0
+syscall
+mov r13, rax
+
+; mov eax, 0x22; ret
+mov dword [r13], 0x000022B8
+mov word [r13 + 4], 0xC300
+call r13
+
+mov rcx, r13
+sub rcx, r12
+
+hlt
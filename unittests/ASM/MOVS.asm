@@ -0,0 +1,55 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x4142434445464748",
+    "RBX": "0x5152535455565758",
+    "RCX": "0x0",
+    "RSI": "0xE7FFFFF8",
+    "RDI": "0xE8000038",
+    "R8":  "0x4848484848484848",
+    "R9":  "0x4848484848484848",
+    "R10": "0x5152535455565758"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe8000000
+mov rax, 0x4142434445464748
+mov [rdx], rax
+mov rax, 0x5152535455565758
+mov [rdx + 8], rax
+
+; Forward copy
+lea rsi, [rdx]
+lea rdi, [rdx + 32]
+mov rcx, 16
+cld
+rep movsb
+
+mov rax, [rdx + 32]
+mov rbx, [rdx + 40]
+
+; Overlapping copy replicates the first byte
+lea rsi, [rdx]
+lea rdi, [rdx + 1]
+mov rcx, 7
+rep movsb
+
+mov r8, [rdx]
+
+; Backwards copy
+std
+lea rsi, [rdx + 8]
+lea rdi, [rdx + 72]
+mov rcx, 2
+rep movsq
+cld
+
+mov r9, [rdx + 64]
+mov r10, [rdx + 72]
+
+hlt
@@ -0,0 +1,40 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x4142434445464748",
+    "RBX": "0x5152535455565758",
+    "RCX": "0x48",
+    "RDX": "0x6162636465666768",
+    "RSP": "0xE8000FF0"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0xe8001000
+
+mov rax, 0x4142434445464748
+mov rbx, 0x5152535455565758
+
+; Stores that get immediately loaded back
+push rax
+push rbx
+pop rdx
+pop rcx
+
+; Overwritten store, the second one must be what lands in memory
+mov rdx, 0x6162636465666768
+push rax
+mov [rsp], rdx
+push rax
+
+; Narrow load of a wider store
+mov cl, [rsp]
+movzx rcx, cl
+
+mov rdx, [rsp + 8]
+
+hlt
@@ -0,0 +1,40 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RCX": "0x4",
+    "RDI": "0xE8000004",
+    "R8":  "0x1",
+    "R9":  "0x0",
+    "R10": "0xE8000004"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe8000000
+mov rax, 0x4142434445464748
+mov [rdx], rax
+
+lea rdi, [rdx]
+mov rax, 0x45
+mov rcx, 8
+cld
+
+; Finds the fourth byte
+repne scasb
+
+mov r8, 0
+setz r8b
+
+; Nothing to scan, flags and pointers are left alone
+mov r10, rdi
+mov rcx, 0
+repne scasb
+
+mov r9, 0
+setnz r9b
+
+hlt
@@ -0,0 +1,29 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x4142434445464748",
+    "RBX": "0x41424344",
+    "RCX": "0x47",
+    "RDX": "0x4546",
+    "RSI": "0x41"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0xe8001000
+
+; Narrower loads that fall inside of an earlier wider store in the same block
+mov rax, 0x4142434445464748
+mov [rsp - 16], rax
+xor edx, edx
+
+mov ebx, [rsp - 12]
+movzx ecx, byte [rsp - 15]
+mov dx, [rsp - 14]
+movzx esi, byte [rsp - 9]
+
+hlt
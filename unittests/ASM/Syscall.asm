@@ -0,0 +1,33 @@
+%ifdef CONFIG
+{
+  "Match": "All",
+  "RegData": {
+    "RAX": "0x0",
+    "RBX": "0x0",
+    "RBP": "0x4142434445464748",
+    "RSP": "0xE8001000"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rsp, 0xe8001000
+mov rbp, 0x4142434445464748
+
+; clock_gettime(CLOCK_MONOTONIC, [rsp - 16])
+mov rax, 228
+mov rdi, 1
+lea rsi, [rsp - 16]
+syscall
+mov rbx, rax
+
+; Zero sized write(1, [rsp - 16], 0)
+mov rax, 1
+mov rdi, 1
+lea rsi, [rsp - 16]
+mov rdx, 0
+syscall
+
+hlt